@@ -1,41 +1,75 @@
 #include "evaluator/Evaluator.hpp"
 #include "logging/Logging.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <climits>
+#include <thread>
 #include <vector>
 using namespace std;
 
 namespace siegbert {
 
-Evaluator::Evaluator() {}
-
-std::string Evaluator::eval(BoardState &bs, int depth) {
-  vector<Move> moves = bs.generate_moves();
-  std::string choice = "resign";
-  int best = INT_MIN;
-  bool has_legal_moves = false;
-  auto memento = bs.memento();
-
-  for (auto &move : moves) {
-    if (bs.make_move(move)) {
-      has_legal_moves = true;
-      negamax.set_boardState(bs);
-
-      int score;
-      if (bs.white_to_move) {
-        score = negamax.negamax(depth, INT_MIN, INT_MAX);
-      } else {
-        score = negamax.negamax(depth, INT_MIN, INT_MAX);
-      }
-      bs.unmake_move(move, memento);
-      if (score > best) {
-        best = score;
-        choice = move.to_str();
-      }
-    }
+Evaluator::Evaluator(int n_threads) { set_threads(n_threads); }
+
+void Evaluator::set_threads(int n_threads) {
+  n_threads = max(1, min(n_threads, MAX_THREADS));
+  searches.clear();
+  for (int i = 0; i < n_threads; i += 1) {
+    searches.emplace_back(new Negamax(&ttable));
+  }
+}
+
+int Evaluator::get_threads() const { return (int)searches.size(); }
+
+void Evaluator::set_hash(size_t megabytes) { ttable.reset(megabytes); }
+
+SearchResult Evaluator::search(BoardState &bs, int depth, int movetime_ms,
+                               const atomic<bool> *stop_signal) {
+  for (auto &negamax : searches) {
+    negamax->set_boardState(bs);
+  }
+  searches[0]->set_stop_signal(stop_signal);
+
+  /* the age is updated before the helpers start storing entries */
+  ttable.new_search();
+
+  /* the helpers run until the main search is over */
+  atomic<bool> stop(false);
+  vector<SearchResult> helper_results(searches.size());
+  vector<thread> helpers;
+  for (size_t i = 1; i < searches.size(); i += 1) {
+    searches[i]->set_stop_signal(&stop);
+    helpers.emplace_back([this, i, movetime_ms, &helper_results] {
+      helper_results[i] =
+          searches[i]->search(Negamax::MAX_PLY - 1, movetime_ms, (int)i);
+    });
   }
-  return choice;
+
+  SearchResult result = searches[0]->search(depth, movetime_ms);
+
+  stop.store(true);
+  for (auto &helper : helpers) {
+    helper.join();
+  }
+  for (auto &helper_result : helper_results) {
+    result.nodes += helper_result.nodes;
+  }
+  return result;
 }
 
-void Evaluator::reset() { negamax.reset(); }
-} // namespace siegbert
\ No newline at end of file
+std::string Evaluator::eval(BoardState &bs, int depth, int movetime_ms) {
+  SearchResult result = search(bs, depth, movetime_ms);
+  if (result.pv.empty()) {
+    return "resign";
+  }
+  return result.best_move.to_str();
+}
+
+void Evaluator::reset() {
+  ttable.clear();
+  for (auto &negamax : searches) {
+    negamax->reset();
+  }
+}
+} // namespace siegbert
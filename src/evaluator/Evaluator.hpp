@@ -2,22 +2,52 @@
 #ifndef Evaluator_HPP
 #define Evaluator_HPP
 
+#include <atomic>
 #include <climits>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "evaluator/Negamax.hpp"
 #include "evaluator/Scorer.hpp"
+#include "evaluator/TranspositionTable.hpp"
 #include "game/BoardState.hpp"
 
 namespace siegbert {
+
+/**
+ * Lazy SMP : every thread searches the root position on its own, they only
+ * share the transposition table. The first thread is the one whose result is
+ * played, the helpers fill the table with entries it will use.
+ */
 class Evaluator {
 private:
-  Negamax negamax;
+  TranspositionTable ttable;
+
+  /* searches[0] runs in the calling thread, the others are helpers */
+  std::vector<std::unique_ptr<Negamax>> searches;
 
 public:
-  Evaluator();
+  static constexpr int MAX_THREADS = 512;
+
+  Evaluator(int n_threads = 1);
+
+  /** @return the best move found in xboard notation, or "resign" */
+  std::string eval(BoardState &boardstate, int depth = 10,
+                   int movetime_ms = 0);
+
+  /** nodes are the total over all threads. The search ends early when stop
+   * is raised by another thread */
+  SearchResult search(BoardState &boardstate, int depth, int movetime_ms = 0,
+                      const std::atomic<bool> *stop = nullptr);
+
+  /** number of search threads, including the calling one */
+  void set_threads(int n_threads);
+
+  int get_threads() const;
 
-  std::string eval(BoardState &boardstate, int depth = 10);
+  /** resizes (and clears) the transposition table */
+  void set_hash(size_t megabytes);
 
   void reset();
 };
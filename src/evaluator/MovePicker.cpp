@@ -0,0 +1,210 @@
+#include "evaluator/MovePicker.hpp"
+
+using namespace std;
+
+namespace siegbert {
+
+/* captures and promotions above this weight are tried before the quiet
+ * moves */
+static const int GOOD_CAPTURE = 10000;
+
+static const int HASH_MOVE_WEIGHT = 20000;
+
+/* most valuable victim, least valuable attacker. Losing trades (according
+ * to the static exchange evaluation) and underpromotions are left for the
+ * end */
+static inline int16_t capture_weight(const BoardState &boardState,
+                                     const Move &move) {
+  int weight =
+      material_value(move.captured) - material_value(move.piece) / 100;
+  if (move.promotion == 'q') {
+    weight += GOOD_CAPTURE + material_value('q');
+  } else if (!move.promotion &&
+             (material_value(move.captured) >= material_value(move.piece) ||
+              boardState.see_ge(move))) {
+    weight += GOOD_CAPTURE;
+  }
+  return (int16_t)weight;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+MovePicker::MovePicker(const BoardState &boardState_, bool in_check,
+                       uint16_t hash_move_, const uint16_t *killers_)
+    : boardState(boardState_), stage(HASH_MOVE), captures_only(false),
+      hash_move(hash_move_), captures_generated(false), captures_index(0),
+      quiets_generated(false), quiets_index(0), killers_index(0) {
+  for (int i = 0; i < MAX_KILLERS; i += 1) {
+    killers[i] = killers_ ? killers_[i] : 0;
+  }
+  if (in_check) {
+    stage = GENERATE_EVASIONS;
+  } else if (!hash_move) {
+    stage = GENERATE_CAPTURES;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+MovePicker::MovePicker(const BoardState &boardState_, bool in_check)
+    : MovePicker(boardState_, in_check, 0, nullptr) {
+  captures_only = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void MovePicker::generate_captures() {
+  if (!captures_generated) {
+    boardState.generate_captures(captures);
+    for (auto &move : captures) {
+      move.weight = capture_weight(boardState, move);
+    }
+    captures_generated = true;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void MovePicker::generate_quiets() {
+  if (!quiets_generated) {
+    boardState.generate_quiets(quiets);
+    quiets_generated = true;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool MovePicker::pick_capture(Move &move, int min_weight) {
+  while (captures_index < captures.size()) {
+    /* selection of the best remaining move : most of them will never be
+     * looked at, so there is no point in sorting the whole list */
+    int best = captures_index;
+    for (int i = captures_index + 1; i < captures.size(); i += 1) {
+      if (captures[i].weight > captures[best].weight) {
+        best = i;
+      }
+    }
+    if (captures[best].weight < min_weight) {
+      return false;
+    }
+    const Move picked = captures[best];
+    captures[best] = captures[captures_index];
+    captures[captures_index] = picked;
+    captures_index += 1;
+    if (picked.to_short() != hash_move) {
+      move = picked;
+      return true;
+    }
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool MovePicker::is_hash_or_killer(const Move &move) const {
+  const uint16_t code = move.to_short();
+  if (code == hash_move) {
+    return true;
+  }
+  for (int i = 0; i < MAX_KILLERS; i += 1) {
+    if (code == killers[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool MovePicker::next(Move &move) {
+  switch (stage) {
+
+  case HASH_MOVE: {
+    stage = GENERATE_CAPTURES;
+    /* the move comes from another position when the hash collides : it is
+     * checked against this one, no move is generated before it is tried */
+    const Move decoded = boardState.move_from_short(hash_move);
+    if (boardState.is_pseudo_legal(decoded) && boardState.is_legal(decoded)) {
+      move = decoded;
+      return true;
+    }
+    hash_move = 0;
+  }
+    /* fall through */
+
+  case GENERATE_CAPTURES:
+    generate_captures();
+    stage = GOOD_CAPTURES;
+    /* fall through */
+
+  case GOOD_CAPTURES:
+    if (pick_capture(move, GOOD_CAPTURE)) {
+      return true;
+    }
+    /* the quiescence search does not try the losing trades */
+    if (captures_only) {
+      stage = DONE;
+      return false;
+    }
+    stage = KILLERS;
+    /* fall through */
+
+  case KILLERS:
+    while (killers_index < MAX_KILLERS) {
+      const uint16_t killer = killers[killers_index++];
+      if (!killer || killer == hash_move) {
+        continue;
+      }
+      /* only the quiet moves : the captures have already been tried */
+      const Move decoded = boardState.move_from_short(killer);
+      if (!decoded.captured && !decoded.promotion &&
+          boardState.is_pseudo_legal(decoded) && boardState.is_legal(decoded)) {
+        move = decoded;
+        return true;
+      }
+    }
+    generate_quiets();
+    stage = QUIETS;
+    /* fall through */
+
+  case QUIETS:
+    while (quiets_index < quiets.size()) {
+      const Move &candidate = quiets[quiets_index++];
+      if (!is_hash_or_killer(candidate)) {
+        move = candidate;
+        return true;
+      }
+    }
+    stage = BAD_CAPTURES;
+    /* fall through */
+
+  case BAD_CAPTURES:
+    if (pick_capture(move, INT16_MIN)) {
+      return true;
+    }
+    stage = DONE;
+    return false;
+
+  case GENERATE_EVASIONS:
+    boardState.generate_evasions(captures);
+    for (auto &evasion : captures) {
+      if (evasion.to_short() == hash_move) {
+        evasion.weight = HASH_MOVE_WEIGHT;
+      } else if (evasion.captured || evasion.promotion) {
+        evasion.weight = capture_weight(boardState, evasion);
+      } else {
+        evasion.weight = 0;
+      }
+    }
+    /* the hash move is not skipped : it has not been returned yet */
+    hash_move = 0;
+    stage = EVASIONS;
+    /* fall through */
+
+  case EVASIONS:
+    if (pick_capture(move, INT16_MIN)) {
+      return true;
+    }
+    stage = DONE;
+    return false;
+
+  case DONE:
+    return false;
+  }
+  return false;
+}
+
+} // namespace siegbert
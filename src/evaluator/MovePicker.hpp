@@ -0,0 +1,96 @@
+#pragma once
+#ifndef MovePicker_HPP
+#define MovePicker_HPP
+
+#include <cstdint>
+
+#include "game/BoardState.hpp"
+
+namespace siegbert {
+
+/**
+ * Yields the legal moves of a position one at a time, best candidates first,
+ * generating them lazily :
+ *
+ *   1. the hash move (from the transposition table, or the principal
+ *      variation)
+ *   2. the good captures and the promotions, most valuable victim first
+ *   3. the killer moves
+ *   4. the other quiet moves
+ *   5. the bad captures (the ones that lose material, see
+ *      BoardState::see_ge())
+ *
+ * When in check all the evasions are generated at once instead. Since most
+ * beta cutoffs happen on the first moves, the quiet moves are often never
+ * generated.
+ */
+class MovePicker {
+public:
+  static const int MAX_KILLERS = 2;
+
+private:
+  enum Stage {
+    HASH_MOVE,
+    GENERATE_CAPTURES,
+    GOOD_CAPTURES,
+    KILLERS,
+    QUIETS,
+    BAD_CAPTURES,
+    GENERATE_EVASIONS,
+    EVASIONS,
+    DONE
+  };
+
+  const BoardState &boardState;
+
+  Stage stage;
+
+  /* the quiescence search only wants captures */
+  bool captures_only;
+
+  uint16_t hash_move;
+
+  uint16_t killers[MAX_KILLERS];
+
+  MoveList captures;
+
+  bool captures_generated;
+
+  int captures_index;
+
+  MoveList quiets;
+
+  bool quiets_generated;
+
+  int quiets_index;
+
+  int killers_index;
+
+  void generate_captures();
+
+  void generate_quiets();
+
+  /** the best remaining capture, if its weight is at least min_weight */
+  bool pick_capture(Move &move, int min_weight);
+
+  bool is_hash_or_killer(const Move &move) const;
+
+public:
+  /** picker for the main search. in_check tells whether the side to move is
+   * in check, the search already knows it. killers points to MAX_KILLERS
+   * moves in their 16 bits form (0 for none), or is null */
+  MovePicker(const BoardState &boardState, bool in_check, uint16_t hash_move,
+             const uint16_t *killers);
+
+  /** picker for the quiescence search : the captures that do not lose
+   * material and the queen promotions only, or all the evasions when in
+   * check */
+  MovePicker(const BoardState &boardState, bool in_check);
+
+  /** the next move to try, false once all the moves have been returned */
+  bool next(Move &move);
+};
+
+} // namespace siegbert
+
+#endif
@@ -0,0 +1,396 @@
+#include "evaluator/Negamax.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "evaluator/MovePicker.hpp"
+using namespace std;
+
+namespace siegbert {
+
+SearchResult::SearchResult() : score(0), depth(0), nodes(0) {}
+
+/* the depths skipped by the Lazy SMP helpers, in blocks : helper i uses the
+ * entry (i - 1) % 20, and skips the depth d when (d + phase) / size is odd.
+ * The first helpers skip every other depth, with alternate phases, the next
+ * ones skip blocks of 2, 3 or 4 depths : the helpers spread over the depths
+ * instead of repeating the iterations of the main search */
+static const int SKIP_SIZE[20] = {1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                  3, 3, 4, 4, 4, 4, 4, 4, 4, 4};
+static const int SKIP_PHASE[20] = {0, 1, 0, 1, 2, 3, 0, 1, 2, 3,
+                                   4, 5, 0, 1, 2, 3, 4, 5, 6, 7};
+
+static inline bool skip_depth(int helper_id, int depth) {
+  if (helper_id == 0) {
+    return false;
+  }
+  const int i = (helper_id - 1) % 20;
+  return ((depth + SKIP_PHASE[i]) / SKIP_SIZE[i]) % 2;
+}
+
+/* mate scores are stored relative to the node, not to the root */
+static inline int score_to_tt(int score, int ply) {
+  if (score > Negamax::MATE_SCORE - Negamax::MAX_PLY) {
+    return score + ply;
+  } else if (score < -Negamax::MATE_SCORE + Negamax::MAX_PLY) {
+    return score - ply;
+  }
+  return score;
+}
+
+static inline int score_from_tt(int score, int ply) {
+  if (score > Negamax::MATE_SCORE - Negamax::MAX_PLY) {
+    return score - ply;
+  } else if (score < -Negamax::MATE_SCORE + Negamax::MAX_PLY) {
+    return score + ply;
+  }
+  return score;
+}
+
+Negamax::Negamax(TranspositionTable *shared_ttable)
+    : ttable(shared_ttable), stop_signal(nullptr), nodes(0), stopped(false),
+      has_deadline(false), interruptible(false), follow_pv(false) {
+  if (!ttable) {
+    own_ttable.reset(new TranspositionTable());
+    ttable = own_ttable.get();
+  }
+  memset(killers, 0, sizeof(killers));
+}
+
+void Negamax::set_boardState(const BoardState &bs) { boardState = bs; }
+
+void Negamax::set_stop_signal(const atomic<bool> *signal) {
+  stop_signal = signal;
+}
+
+void Negamax::reset() {
+  /* a shared table is cleared by its owner */
+  if (own_ttable) {
+    own_ttable->clear();
+  }
+  previous_pv.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int Negamax::evaluate() {
+  int score = scorer.getScore(boardState);
+  return boardState.white_to_move ? score : -score;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void Negamax::check_time() {
+  if (has_deadline && chrono::steady_clock::now() >= deadline) {
+    stopped = true;
+  } else if (interruptible && stop_signal &&
+             stop_signal->load(memory_order_relaxed)) {
+    stopped = true;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void Negamax::store_killer(int ply, const Move &move) {
+  const uint16_t code = move.to_short();
+  if (killers[ply][0] != code) {
+    for (int i = MovePicker::MAX_KILLERS - 1; i > 0; i -= 1) {
+      killers[ply][i] = killers[ply][i - 1];
+    }
+    killers[ply][0] = code;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int Negamax::quiesce(int alpha, int beta, int ply) {
+
+  pv_length[ply] = ply;
+
+  if ((nodes & 1023) == 0) {
+    check_time();
+  }
+  if (stopped) {
+    return 0;
+  }
+
+  nodes += 1;
+
+  if (ply >= MAX_PLY - 1) {
+    return evaluate();
+  }
+
+  /* when in check, every evasion is searched : there is no standing pat */
+  const bool in_check = boardState.is_check();
+  int best = -INFINITE_SCORE;
+  if (!in_check) {
+    best = evaluate();
+    if (best >= beta) {
+      return best;
+    }
+    alpha = max(alpha, best);
+  }
+
+  auto memento = boardState.memento();
+  MovePicker picker(boardState, in_check);
+  Move move;
+  int legal = 0;
+  /* the picker leaves out the captures that lose material */
+  while (picker.next(move)) {
+    legal += 1;
+    boardState.make_legal_move(move);
+    const int score = -quiesce(-beta, -alpha, ply + 1);
+    boardState.unmake_move(move, memento);
+
+    if (stopped) {
+      return 0;
+    }
+
+    if (score > best) {
+      best = score;
+      if (score > alpha) {
+        alpha = score;
+        if (alpha >= beta) {
+          break;
+        }
+      }
+    }
+  }
+
+  if (in_check && legal == 0) {
+    return -MATE_SCORE + ply;
+  }
+  return best;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int Negamax::pvs(int depth, int alpha, int beta, int ply) {
+
+  pv_length[ply] = ply;
+
+  if ((nodes & 1023) == 0) {
+    check_time();
+  }
+  if (stopped) {
+    return 0;
+  }
+
+  /* fifty moves rule, and repetitions : a position that already occurred
+   * after the root is scored as a draw, the opponent could repeat it again.
+   * A position of the game up to the root must have occurred twice */
+  if (ply > 0 &&
+      (boardState.is_fifty_moves() || boardState.is_repetition(2, ply))) {
+    return 0;
+  }
+
+  if (ply >= MAX_PLY - 1) {
+    return evaluate();
+  }
+
+  const uint64_t z = boardState.get_zobrist_hash();
+  TTableEntry entry;
+  const bool tt_hit = ttable->find(z, entry);
+  const uint16_t tt_move = tt_hit ? entry.move : 0;
+  if (tt_hit && ply > 0 && entry.depth >= depth) {
+    const int value = score_from_tt(entry.value, ply);
+    if (entry.flag == EXACT) {
+      return value;
+    } else if (entry.flag == LOWERBOUND) {
+      alpha = max(alpha, value);
+    } else {
+      beta = min(beta, value);
+    }
+    if (alpha >= beta) {
+      return value;
+    }
+  }
+
+  if (depth <= 0) {
+    return quiesce(alpha, beta, ply);
+  }
+
+  nodes += 1;
+
+  const int original_alpha = alpha;
+  int best = -INFINITE_SCORE;
+  uint16_t best_move = 0;
+  int legal = 0;
+
+  /* the move of the previous iteration's principal variation comes first */
+  const uint16_t pv_move = follow_pv && ply < (int)previous_pv.size()
+                               ? previous_pv[ply].to_short()
+                               : 0;
+  follow_pv = false;
+
+  auto memento = boardState.memento();
+  const bool in_check = boardState.is_check();
+  const CheckInfo check_info = boardState.check_info();
+  MovePicker picker(boardState, in_check, pv_move ? pv_move : tt_move,
+                    killers[ply]);
+  Move move;
+  while (picker.next(move)) {
+    if (pv_move && legal == 0 && move.to_short() == pv_move) {
+      follow_pv = true;
+    }
+
+    /* check extension : the checks are searched one ply deeper */
+    const int new_depth =
+        depth - 1 + (boardState.gives_check(move, check_info) ? 1 : 0);
+
+    boardState.make_legal_move(move);
+    legal += 1;
+
+    int score;
+    if (legal == 1) {
+      score = -pvs(new_depth, -beta, -alpha, ply + 1);
+    } else {
+      /* null window search, re-search if it turns out to be better */
+      score = -pvs(new_depth, -alpha - 1, -alpha, ply + 1);
+      if (score > alpha && score < beta) {
+        score = -pvs(new_depth, -beta, -alpha, ply + 1);
+      }
+    }
+    boardState.unmake_move(move, memento);
+
+    if (stopped) {
+      return 0;
+    }
+
+    if (score > best) {
+      best = score;
+      best_move = move.to_short();
+      if (score > alpha) {
+        alpha = score;
+
+        /* update the principal variation */
+        pv_table[ply][ply] = move;
+        for (int i = ply + 1; i < pv_length[ply + 1]; i += 1) {
+          pv_table[ply][i] = pv_table[ply + 1][i];
+        }
+        pv_length[ply] = pv_length[ply + 1];
+
+        if (alpha >= beta) {
+          if (!move.captured && !move.promotion) {
+            store_killer(ply, move);
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  if (legal == 0) {
+    return in_check ? -MATE_SCORE + ply : 0;
+  }
+
+  TTableEntry result;
+  result.depth = depth;
+  result.value = score_to_tt(best, ply);
+  result.move = best_move;
+  if (best <= original_alpha) {
+    result.flag = UPPERBOUND;
+  } else if (best >= beta) {
+    result.flag = LOWERBOUND;
+  } else {
+    result.flag = EXACT;
+  }
+  ttable->put(z, result);
+
+  return best;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int Negamax::negamax(int depth, int alpha, int beta) {
+  alpha = max(alpha, -INFINITE_SCORE);
+  beta = min(beta, INFINITE_SCORE);
+  stopped = false;
+  has_deadline = false;
+  follow_pv = false;
+  return pvs(depth, alpha, beta, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+vector<Move> Negamax::principal_variation() const {
+  return vector<Move>(pv_table[0], pv_table[0] + pv_length[0]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+SearchResult Negamax::search(int max_depth, int movetime_ms, int helper_id) {
+  SearchResult result;
+
+  const auto start = chrono::steady_clock::now();
+  deadline = start + chrono::milliseconds(movetime_ms);
+  stopped = false;
+  nodes = 0;
+  previous_pv.clear();
+  /* a shared table is aged by its owner, before the searches start */
+  if (own_ttable) {
+    ttable->new_search();
+  }
+  memset(killers, 0, sizeof(killers));
+
+  max_depth = min(max_depth, MAX_PLY - 1);
+
+  for (int depth = 1; depth <= max_depth; depth += 1) {
+    if (skip_depth(helper_id, depth)) {
+      continue;
+    }
+
+    /* the first iteration always completes, so that there is a move to play */
+    interruptible = depth > 1;
+    has_deadline = movetime_ms > 0 && interruptible;
+
+    int alpha = -INFINITE_SCORE;
+    int beta = INFINITE_SCORE;
+    if (result.depth > 0) {
+      alpha = result.score - ASPIRATION_WINDOW;
+      beta = result.score + ASPIRATION_WINDOW;
+    }
+
+    int score;
+    while (true) {
+      follow_pv = true;
+      score = pvs(depth, alpha, beta, 0);
+      if (stopped) {
+        break;
+      }
+      /* the score fell outside of the window : search again with a wider
+       * window on the failing side */
+      if (score <= alpha) {
+        alpha = -INFINITE_SCORE;
+      } else if (score >= beta) {
+        beta = INFINITE_SCORE;
+      } else {
+        break;
+      }
+    }
+
+    if (stopped) {
+      break;
+    }
+
+    result.score = score;
+    result.depth = depth;
+    result.pv = principal_variation();
+    if (!result.pv.empty()) {
+      result.best_move = result.pv.front();
+    }
+    previous_pv = result.pv;
+
+    /* no legal move, or a forced mate was found */
+    if (result.pv.empty() || abs(score) > MATE_SCORE - MAX_PLY) {
+      break;
+    }
+
+    /* the next iteration would most probably not complete in time */
+    if (has_deadline) {
+      auto elapsed = chrono::steady_clock::now() - start;
+      if (elapsed * 2 > chrono::milliseconds(movetime_ms)) {
+        break;
+      }
+    }
+  }
+
+  result.nodes = nodes;
+  has_deadline = false;
+  interruptible = false;
+  return result;
+}
+
+} // namespace siegbert
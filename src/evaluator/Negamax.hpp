@@ -0,0 +1,125 @@
+#pragma once
+#ifndef Negamax_HPP
+#define Negamax_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "evaluator/MovePicker.hpp"
+#include "evaluator/Scorer.hpp"
+#include "evaluator/TranspositionTable.hpp"
+#include "game/BoardState.hpp"
+
+namespace siegbert {
+
+/** outcome of an iterative deepening search */
+struct SearchResult {
+  SearchResult();
+
+  Move best_move;
+
+  /** principal variation, starting with best_move (empty if no legal move) */
+  std::vector<Move> pv;
+
+  /** side-to-move relative score of the last completed iteration */
+  int score;
+
+  /** depth of the last completed iteration */
+  int depth;
+
+  uint64_t nodes;
+};
+
+class Negamax {
+
+public:
+  static constexpr int INFINITE_SCORE = 1000000;
+
+  static constexpr int MATE_SCORE = 100000;
+
+  static constexpr int MAX_PLY = 64;
+
+  static constexpr int ASPIRATION_WINDOW = 50;
+
+private:
+  BoardState boardState = BoardState::initial();
+
+  /* only allocated when the table is not shared with other searches */
+  std::unique_ptr<TranspositionTable> own_ttable;
+
+  TranspositionTable *ttable;
+
+  /* set by another thread to interrupt the search */
+  const std::atomic<bool> *stop_signal;
+
+  Scorer scorer;
+
+  uint64_t nodes;
+
+  bool stopped;
+
+  bool has_deadline;
+
+  /* false during the first iteration, which the stop signal does not
+   * interrupt */
+  bool interruptible;
+
+  std::chrono::steady_clock::time_point deadline;
+
+  /* triangular principal variation table */
+  Move pv_table[MAX_PLY][MAX_PLY];
+
+  int pv_length[MAX_PLY];
+
+  /* pv of the previous iteration, searched first */
+  std::vector<Move> previous_pv;
+
+  bool follow_pv;
+
+  /* quiet moves that caused a beta cutoff, by ply */
+  uint16_t killers[MAX_PLY][MovePicker::MAX_KILLERS];
+
+  int pvs(int depth, int alpha, int beta, int ply);
+
+  /** searches the captures only, until the position is quiet */
+  int quiesce(int alpha, int beta, int ply);
+
+  int evaluate();
+
+  void store_killer(int ply, const Move &move);
+
+  void check_time();
+
+public:
+  /** when shared_ttable is null, the search uses a table of its own */
+  Negamax(TranspositionTable *shared_ttable = nullptr);
+
+  void set_boardState(const BoardState &boardState);
+
+  /** the search stops as soon as the signal is raised, once the first
+   * iteration is complete */
+  void set_stop_signal(const std::atomic<bool> *signal);
+
+  /** fixed-depth alpha-beta search of the current position. The score is
+   * relative to the side to move */
+  int negamax(int depth, int alpha, int beta);
+
+  /** iterative deepening until max_depth is reached or movetime_ms (if > 0) is
+   * elapsed. Helpers (helper_id > 0) are Lazy SMP threads searching the same
+   * position as the main search : they only feed the shared table, and each
+   * one skips its own blocks of depths so that they do not all search the
+   * same tree */
+  SearchResult search(int max_depth, int movetime_ms = 0, int helper_id = 0);
+
+  /** moves of the principal variation found by the last call to negamax() */
+  std::vector<Move> principal_variation() const;
+
+  void reset();
+};
+
+} // namespace siegbert
+
+#endif
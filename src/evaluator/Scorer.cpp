@@ -2,15 +2,6 @@
 
 namespace siegbert {
 
-int Scorer::getScore(BoardState &bs) {
-  PiecesCount count = bs.count_pieces();
-  int white = count.white_pawns + count.white_bishops * 3 +
-              count.white_knights * 3 + count.white_rooks * 5 +
-              count.white_queens * 10;
-  int black = count.black_pawns + count.black_bishops * 3 +
-              count.black_knights * 3 + count.black_rooks * 5 +
-              count.black_queens * 10;
-  return white - black;
-}
+int Scorer::getScore(BoardState &bs) { return bs.psq_score(); }
 
-} // namespace siegbert
\ No newline at end of file
+} // namespace siegbert
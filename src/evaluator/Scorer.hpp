@@ -6,7 +6,9 @@ namespace siegbert {
 class Scorer {
 
 public:
-  /** !! signed score ( should return a value <0 if better for black) */
+  /** !! signed score, in centipawns ( should return a value <0 if better for
+   * black). This is the tapered piece-square tables score, which make and
+   * unmake keep up to date : there is nothing to count here */
   int getScore(BoardState &boardState);
 };
 
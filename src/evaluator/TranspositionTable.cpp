@@ -1,74 +1,130 @@
 #include "TranspositionTable.hpp"
 
+#include <climits>
+
 namespace siegbert {
 
-TranspositionTable::TranspositionTable(int _max_hunks,
-                                       int _max_entries_per_hunk)
-    : max_hunks(_max_hunks), max_entries_per_hunk(_max_entries_per_hunk) {
-  reset(max_hunks, max_entries_per_hunk);
+/*
+ data layout (bit 0 is the least significant bit)
+
+ bits       meaning
+ ==================================
+ 0..31      value
+ 32..39     depth (signed)
+ 40..41     flag + 1 (so that an empty slot is all zeroes)
+ 42..47     age of the search that wrote the entry
+ 48..63     best move (16 bits form)
+*/
+
+#define DATA_DEPTH(d) ((int)(int8_t)(((d) >> 32) & 0xff))
+#define DATA_FLAG(d) ((int)(((d) >> 40) & 0x3))
+#define DATA_AGE(d) ((uint8_t)(((d) >> 42) & 0x3f))
+#define DATA_MOVE(d) ((uint16_t)((d) >> 48))
+
+TranspositionTable::TranspositionTable(size_t megabytes) : mask(0), age(0) {
+  reset(megabytes);
 }
 
 TranspositionTable::~TranspositionTable() {}
 
+uint64_t TranspositionTable::pack(const TTableEntry &entry, uint8_t age) {
+  int depth = entry.depth;
+  if (depth > INT8_MAX) {
+    depth = INT8_MAX;
+  } else if (depth < INT8_MIN) {
+    depth = INT8_MIN;
+  }
+  return ((uint64_t)(uint32_t)entry.value) |
+         ((uint64_t)(uint8_t)depth << 32) |
+         ((uint64_t)(entry.flag + 1) << 40) |
+         ((uint64_t)(age & 0x3f) << 42) | ((uint64_t)entry.move << 48);
+}
+
+TTableEntry TranspositionTable::unpack(uint64_t data) {
+  TTableEntry entry;
+  entry.value = (int)(uint32_t)(data & 0xffffffff);
+  entry.depth = DATA_DEPTH(data);
+  entry.flag = (flag_t)(DATA_FLAG(data) - 1);
+  entry.move = DATA_MOVE(data);
+  return entry;
+}
+
 void TranspositionTable::put(uint64_t z, const TTableEntry &entry) {
-  std::lock_guard<std::mutex> lg(mutex);
+  Bucket &bucket = bucket_for(z);
+  Slot *victim = nullptr;
+  int victim_score = INT_MAX;
+  uint16_t previous_move = 0;
 
-  auto it = hunks.rbegin();
-  auto rend = hunks.rend();
+  for (Slot &slot : bucket.slots) {
+    const uint64_t data = slot.data.load(std::memory_order_relaxed);
+    const uint64_t check = slot.check.load(std::memory_order_relaxed);
 
-  do {
-    auto m_it = it->find(z);
-    if (m_it != it->end()) {
-      m_it->second = entry;
-      return;
+    /* same position : always overwrite */
+    if ((check ^ data) == z && DATA_FLAG(data)) {
+      victim = &slot;
+      previous_move = DATA_MOVE(data);
+      break;
     }
-    ++it;
-  } while (it != rend);
 
-  if (iterator->size() == max_entries_per_hunk) {
-    iterator++;
-    if (iterator == hunks.end()) {
-      shrink();
+    /* empty slot */
+    if (!DATA_FLAG(data)) {
+      victim = &slot;
+      victim_score = INT_MIN;
+      continue;
     }
-  }
 
-  (*iterator)[z] = entry;
-}
+    /* prefer replacing shallow entries left by older searches */
+    const int relative_age = (age - DATA_AGE(data)) & 0x3f;
+    const int score = DATA_DEPTH(data) - 8 * relative_age;
+    if (score < victim_score) {
+      victim = &slot;
+      victim_score = score;
+    }
+  }
 
-void TranspositionTable::shrink() {
-  using namespace std;
-  hunks.pop_front();
-  hunks.push_back(map<uint64_t, TTableEntry>());
-  iterator = hunks.end();
-  iterator--;
+  uint64_t data = pack(entry, age);
+  /* keep the best move we already knew, if any */
+  if (!entry.move && previous_move) {
+    data |= (uint64_t)previous_move << 48;
+  }
+  victim->check.store(z ^ data, std::memory_order_relaxed);
+  victim->data.store(data, std::memory_order_relaxed);
 }
 
 bool TranspositionTable::find(uint64_t z, TTableEntry &result) {
-  std::lock_guard<std::mutex> lg(mutex);
-
-  // scan all the hunks, more recent first
-  auto it = hunks.rbegin();
-  auto rend = hunks.rend();
-  do {
-    auto m_it = it->find(z);
-    if (m_it != it->end()) {
-      result = m_it->second;
+  Bucket &bucket = bucket_for(z);
+  for (Slot &slot : bucket.slots) {
+    const uint64_t data = slot.data.load(std::memory_order_relaxed);
+    const uint64_t check = slot.check.load(std::memory_order_relaxed);
+    if ((check ^ data) == z && DATA_FLAG(data)) {
+      result = unpack(data);
       return true;
     }
-    it++;
-  } while (it != rend);
+  }
   return false;
 }
 
-void TranspositionTable::reset(int _max_hunks, int _max_entries_per_hunk) {
-  std::lock_guard<std::mutex> lg(mutex);
-  this->max_hunks = _max_hunks;
-  this->max_entries_per_hunk = _max_entries_per_hunk;
-  hunks.clear();
-  for (int i = 0; i < max_hunks; ++i) {
-    hunks.push_back(std::map<uint64_t, TTableEntry>());
+void TranspositionTable::reset(size_t megabytes) {
+  size_t nbuckets = 1;
+  const size_t wanted = (megabytes << 20) / sizeof(Bucket);
+  while (nbuckets * 2 <= wanted) {
+    nbuckets *= 2;
   }
-  iterator = hunks.begin();
+  buckets = std::vector<Bucket>(nbuckets);
+  mask = nbuckets - 1;
+  age = 0;
 }
 
-} // namespace siegbert
\ No newline at end of file
+void TranspositionTable::clear() {
+  for (Bucket &bucket : buckets) {
+    for (Slot &slot : bucket.slots) {
+      slot.check.store(0, std::memory_order_relaxed);
+      slot.data.store(0, std::memory_order_relaxed);
+    }
+  }
+  age = 0;
+}
+
+void TranspositionTable::new_search() { age = (age + 1) & 0x3f; }
+
+} // namespace siegbert
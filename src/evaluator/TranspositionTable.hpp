@@ -1,10 +1,10 @@
 #ifndef TranspositionTable_HPP
 #define TranspositionTable_HPP
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
-#include <list>
-#include <map>
-#include <mutex>
+#include <vector>
 
 namespace siegbert {
 
@@ -14,24 +14,44 @@ struct TTableEntry {
   int depth;
   flag_t flag;
   int value;
+  /** best move in its 16 bits form (see PackedMove), 0 if unknown */
+  uint16_t move;
 };
 
+/**
+ * Fixed-size hash table indexed by the zobrist hash of the position.
+ *
+ * Each slot stores (key ^ data, data) so that a torn write coming from
+ * another thread is detected when probing and treated as a miss : no lock is
+ * ever taken. A bucket holds 4 slots and fits in a single cache line.
+ */
 class TranspositionTable {
 private:
-  std::mutex mutex;
+  struct Slot {
+    std::atomic<uint64_t> check; /* key ^ data */
+    std::atomic<uint64_t> data;
+  };
 
-  std::list<std::map<uint64_t, TTableEntry>> hunks;
+  static const int SLOTS_PER_BUCKET = 4;
 
-  std::list<std::map<uint64_t, TTableEntry>>::iterator iterator;
+  struct alignas(64) Bucket {
+    Slot slots[SLOTS_PER_BUCKET];
+  };
 
-  int max_hunks;
+  std::vector<Bucket> buckets;
 
-  int max_entries_per_hunk;
+  uint64_t mask;
 
-  void shrink();
+  uint8_t age;
+
+  static uint64_t pack(const TTableEntry &entry, uint8_t age);
+
+  static TTableEntry unpack(uint64_t data);
+
+  Bucket &bucket_for(uint64_t z) { return buckets[z & mask]; }
 
 public:
-  TranspositionTable(int max_hunks = 10, int max_entries_per_hunk = 10000);
+  TranspositionTable(size_t megabytes = 16);
 
   virtual ~TranspositionTable();
 
@@ -39,9 +59,21 @@ public:
 
   bool find(uint64_t z, TTableEntry &result);
 
-  void reset(int max_hunks = 10, int max_entries_per_hunk = 10000);
+  /** resizes the table (rounded down to a power of two) and clears it */
+  void reset(size_t megabytes = 16);
+
+  /** forgets all the entries, keeping the current size */
+  void clear();
+
+  /** to be called at the start of each search, so that the entries of the
+   * previous searches get replaced first. The age is not atomic : this must
+   * be called before the search threads start */
+  void new_search();
+
+  /** number of entries the table can hold */
+  size_t capacity() const { return buckets.size() * SLOTS_PER_BUCKET; }
 };
 
 } // namespace siegbert
 
-#endif
\ No newline at end of file
+#endif
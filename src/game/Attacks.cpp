@@ -0,0 +1,83 @@
+#include "game/Attacks.hpp"
+
+namespace siegbert {
+
+uint64_t ROOK_ATTACKS[ROOK_ATTACKS_SIZE];
+
+uint64_t BISHOP_ATTACKS[BISHOP_ATTACKS_SIZE];
+
+uint64_t BETWEEN[64][64];
+
+uint64_t LINE[64][64];
+
+template <const uint64_t ray[64][8]>
+inline uint64_t ray_attack(const uint64_t occupied, const int offset) {
+  uint64_t a = 0;
+  const uint64_t *ptr = ray[offset];
+  while (*ptr) {
+    a = a | *ptr;
+    if (*ptr & occupied) {
+      break;
+    }
+    ptr += 1;
+  }
+  return a;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint64_t rook_attacks_rays(int offset, uint64_t occupied) {
+  return ray_attack<ROOK_RAY_N>(occupied, offset) |
+         ray_attack<ROOK_RAY_E>(occupied, offset) |
+         ray_attack<ROOK_RAY_S>(occupied, offset) |
+         ray_attack<ROOK_RAY_W>(occupied, offset);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint64_t bishop_attacks_rays(int offset, uint64_t occupied) {
+  return ray_attack<BISHOP_RAY_NE>(occupied, offset) |
+         ray_attack<BISHOP_RAY_SE>(occupied, offset) |
+         ray_attack<BISHOP_RAY_NW>(occupied, offset) |
+         ray_attack<BISHOP_RAY_SW>(occupied, offset);
+}
+
+/* fills the attack tables for every occupancy of the relevant squares */
+static bool init_attacks() {
+  for (int offset = 0; offset < 64; offset += 1) {
+    uint64_t occupied = 0;
+    do {
+      ROOK_ATTACKS[rook_index(offset, occupied)] =
+          rook_attacks_rays(offset, occupied);
+      occupied = (occupied - ROOK_MASKS[offset]) & ROOK_MASKS[offset];
+    } while (occupied);
+
+    occupied = 0;
+    do {
+      BISHOP_ATTACKS[bishop_index(offset, occupied)] =
+          bishop_attacks_rays(offset, occupied);
+      occupied = (occupied - BISHOP_MASKS[offset]) & BISHOP_MASKS[offset];
+    } while (occupied);
+  }
+
+  for (int a = 0; a < 64; a += 1) {
+    const uint64_t bboard_a = ((uint64_t)1) << a;
+    for (int b = 0; b < 64; b += 1) {
+      const uint64_t bboard_b = ((uint64_t)1) << b;
+      if (rook_attacks_rays(a, 0) & bboard_b) {
+        LINE[a][b] = (rook_attacks_rays(a, 0) & rook_attacks_rays(b, 0)) |
+                     bboard_a | bboard_b;
+        BETWEEN[a][b] =
+            rook_attacks_rays(a, bboard_b) & rook_attacks_rays(b, bboard_a);
+      } else if (bishop_attacks_rays(a, 0) & bboard_b) {
+        LINE[a][b] = (bishop_attacks_rays(a, 0) & bishop_attacks_rays(b, 0)) |
+                     bboard_a | bboard_b;
+        BETWEEN[a][b] =
+            bishop_attacks_rays(a, bboard_b) & bishop_attacks_rays(b, bboard_a);
+      }
+    }
+  }
+  return true;
+}
+
+static const bool attacks_initialized = init_attacks();
+
+} // namespace siegbert
@@ -0,0 +1,126 @@
+#pragma once
+#ifndef Attacks_HPP
+#define Attacks_HPP
+
+#include <cstdint>
+
+#if defined(SIEGBERT_USE_PEXT) || defined(SIEGBERT_USE_AVX2)
+#include <immintrin.h>
+#endif
+
+#include "game/BoardState_constants.hpp"
+
+/*
+ Sliding pieces attacks.
+
+ The backend is chosen at build time (see SIEGBERT_SLIDING_ATTACKS in
+ CMakeLists.txt) :
+   - magic : "fancy" magic bitboards, the default
+   - pext  : same tables, indexed using the BMI2 pext instruction
+   - rays  : walks the rays square by square (reference implementation)
+
+ Pawn attacks are computed for all the pawns at once, by shifting the pawns
+ bitboard. With SIEGBERT_AVX2 both capture directions are shifted together.
+*/
+
+namespace siegbert {
+
+extern uint64_t ROOK_ATTACKS[ROOK_ATTACKS_SIZE];
+
+extern uint64_t BISHOP_ATTACKS[BISHOP_ATTACKS_SIZE];
+
+/** squares strictly between two aligned squares, 0 if they are not aligned */
+extern uint64_t BETWEEN[64][64];
+
+/** the whole rank, file or diagonal going through two aligned squares, 0 if
+ * they are not aligned */
+extern uint64_t LINE[64][64];
+
+/** offset (0..63) of the least significant bit, bboard must not be 0 */
+inline int lsb(uint64_t bboard) { return __builtin_ctzll(bboard); }
+
+/** removes the least significant bit, and returns its offset */
+inline int pop_lsb(uint64_t &bboard) {
+  const int offset = lsb(bboard);
+  bboard &= bboard - 1;
+  return offset;
+}
+
+uint64_t rook_attacks_rays(int offset, uint64_t occupied);
+
+uint64_t bishop_attacks_rays(int offset, uint64_t occupied);
+
+inline uint32_t rook_index(int offset, uint64_t occupied) {
+#if defined(SIEGBERT_USE_PEXT)
+  return ROOK_OFFSETS[offset] + _pext_u64(occupied, ROOK_MASKS[offset]);
+#else
+  return ROOK_OFFSETS[offset] +
+         (((occupied & ROOK_MASKS[offset]) * ROOK_MAGICS[offset]) >>
+          ROOK_SHIFTS[offset]);
+#endif
+}
+
+inline uint32_t bishop_index(int offset, uint64_t occupied) {
+#if defined(SIEGBERT_USE_PEXT)
+  return BISHOP_OFFSETS[offset] + _pext_u64(occupied, BISHOP_MASKS[offset]);
+#else
+  return BISHOP_OFFSETS[offset] +
+         (((occupied & BISHOP_MASKS[offset]) * BISHOP_MAGICS[offset]) >>
+          BISHOP_SHIFTS[offset]);
+#endif
+}
+
+inline uint64_t rook_attacks(int offset, uint64_t occupied) {
+#if defined(SIEGBERT_USE_RAYS)
+  return rook_attacks_rays(offset, occupied);
+#else
+  return ROOK_ATTACKS[rook_index(offset, occupied)];
+#endif
+}
+
+inline uint64_t bishop_attacks(int offset, uint64_t occupied) {
+#if defined(SIEGBERT_USE_RAYS)
+  return bishop_attacks_rays(offset, occupied);
+#else
+  return BISHOP_ATTACKS[bishop_index(offset, occupied)];
+#endif
+}
+
+inline uint64_t queen_attacks(int offset, uint64_t occupied) {
+  return rook_attacks(offset, occupied) | bishop_attacks(offset, occupied);
+}
+
+const uint64_t FILE_A = 0x0101010101010101ULL;
+const uint64_t FILE_H = 0x8080808080808080ULL;
+const uint64_t RANK_1 = 0x00000000000000ffULL;
+const uint64_t RANK_3 = 0x0000000000ff0000ULL;
+const uint64_t RANK_6 = 0x0000ff0000000000ULL;
+const uint64_t RANK_8 = 0xff00000000000000ULL;
+
+/** the pawns moved one rank forward */
+template <bool white> inline uint64_t pawn_pushes(uint64_t pawns) {
+  return white ? pawns << 8 : pawns >> 8;
+}
+
+/** squares attacked by the pawns towards the a-file (west) and towards the
+ * h-file (east). A pawn on to comes from to - delta, where delta is 7 and 9
+ * for white, -9 and -7 for black */
+template <bool white>
+inline void pawn_attacks(uint64_t pawns, uint64_t &west, uint64_t &east) {
+#if defined(SIEGBERT_USE_AVX2)
+  const __m128i v = _mm_and_si128(_mm_set1_epi64x((long long)pawns),
+                                  _mm_set_epi64x(~FILE_H, ~FILE_A));
+  const __m128i attacks =
+      white ? _mm_sllv_epi64(v, _mm_set_epi64x(9, 7))
+            : _mm_srlv_epi64(v, _mm_set_epi64x(7, 9));
+  west = (uint64_t)_mm_cvtsi128_si64(attacks);
+  east = (uint64_t)_mm_extract_epi64(attacks, 1);
+#else
+  west = white ? (pawns & ~FILE_A) << 7 : (pawns & ~FILE_A) >> 9;
+  east = white ? (pawns & ~FILE_H) << 9 : (pawns & ~FILE_H) >> 7;
+#endif
+}
+
+} // namespace siegbert
+
+#endif
@@ -1,28 +1,28 @@
 
 #include <libpopcnt.h>
 
+#include <algorithm>
+#include <cassert>
 #include <functional>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 using namespace std;
 
+#include "game/Attacks.hpp"
 #include "game/BoardState.hpp"
 #include "game/BoardState_constants.hpp"
-#include "utils/StringUtils.hpp"
+#include "game/PieceSquareTables.hpp"
 
 namespace siegbert {
 
-const string abcdefgh = "abcdefgh";
-
 Castling::Castling() : kingside(false), queenside(false) {}
 
-Piece::Piece() : name('\0'), square(0) {}
-
-State::State()
-    : presence(0), pawns(0), rooks(0), knights(0), bishops(0), king(0),
-      npieces(0) {}
+State::State(bool white)
+    : presence(0), pawns(0), knights(0), bishops(0), rooks(0), queens(0),
+      king(0), board{}, psq_flip(white ? 56 : 0), mg(0), eg(0), phase(0) {}
 
 Move::Move()
     : from(0), to(0), piece(0), captured(0), promotion(0), enpassant(0),
@@ -137,6 +137,68 @@ uint16_t Move::to_polyglot(bool white) const {
   return to_file | to_row | from_file | from_row | prom;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+static inline uint32_t piece_code(char piece) {
+  switch (piece) {
+  case 'p':
+    return 1;
+  case 'n':
+    return 2;
+  case 'b':
+    return 3;
+  case 'r':
+    return 4;
+  case 'q':
+    return 5;
+  case 'k':
+    return 6;
+  }
+  return 0;
+}
+
+static const char code_piece[8] = {'\0', 'p', 'n', 'b', 'r', 'q', 'k', '\0'};
+
+/* promotions are encoded as piece_code() - 1 : n=1, b=2, r=3, q=4 */
+static inline uint32_t promotion_code(char promotion) {
+  return promotion ? piece_code(promotion) - 1 : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint16_t Move::to_short() const {
+  return from | (to << 6) | (promotion_code(promotion) << 12);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+PackedMove::PackedMove(const Move &move)
+    : data(move.to_short() | (piece_code(move.piece) << 15) |
+           (piece_code(move.captured) << 18) | (move.enpassant << 21) |
+           (move.kingside_castling << 22) | (move.queenside_castling << 23) |
+           (move.pawn_jumstart << 24)) {}
+
+////////////////////////////////////////////////////////////////////////////////
+Move PackedMove::unpack() const {
+  Move move;
+  move.from = from_offset();
+  move.to = to_offset();
+  const int prom = (data >> 12) & 0x7;
+  move.promotion = prom ? code_piece[prom + 1] : '\0';
+  move.piece = code_piece[(data >> 15) & 0x7];
+  move.captured = code_piece[(data >> 18) & 0x7];
+  move.enpassant = (data >> 21) & 1;
+  move.kingside_castling = (data >> 22) & 1;
+  move.queenside_castling = (data >> 23) & 1;
+  move.pawn_jumstart = (data >> 24) & 1;
+  return move;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+string PackedMove::to_str() const { return unpack().to_str(); }
+
+////////////////////////////////////////////////////////////////////////////////
+uint16_t PackedMove::to_polyglot(bool white) const {
+  return unpack().to_polyglot(white);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 string Move::to_json() const {
   ostringstream ss;
@@ -175,33 +237,46 @@ ostream &operator<<(ostream &os, const Move &move) {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void State::enplace(char p, square_t square) {
-  uint64_t bboard = BBOARD(square);
-  presence |= bboard;
-  switch (p) {
+const uint64_t &State::bitboard(char piece) const {
+  switch (piece) {
   case 'p':
-    pawns |= bboard;
-    break;
-  case 'r':
-    rooks |= bboard;
-    break;
+    return pawns;
+  case 'n':
+    return knights;
   case 'b':
-    bishops |= bboard;
-    break;
+    return bishops;
+  case 'r':
+    return rooks;
   case 'q':
-    rooks |= bboard;
-    bishops |= bboard;
-    break;
-  case 'n':
-    knights |= bboard;
-    break;
+    return queens;
   case 'k':
-    king = bboard;
-    break;
+    return king;
   }
-  pieces[npieces].name = p;
-  pieces[npieces].square = square;
-  npieces += 1;
+  assert(!"not a piece");
+  return king;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint64_t &State::bitboard(char piece) {
+  return const_cast<uint64_t &>(as_const(*this).bitboard(piece));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void State::enplace(char p, square_t square) {
+  const uint64_t bboard = BBOARD(square);
+  presence |= bboard;
+  bitboard(p) |= bboard;
+  board[square] = p;
+  update_psq(p, square, 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void State::update_psq(char piece, square_t square, int sign) {
+  const int index = psq_index(piece);
+  const int relative = square ^ psq_flip;
+  mg += sign * (PSQ_MATERIAL_MG[index] + PSQ_MG[index][relative]);
+  eg += sign * (PSQ_MATERIAL_EG[index] + PSQ_EG[index][relative]);
+  phase += sign * PSQ_PHASE[index];
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -223,187 +298,92 @@ string State::to_str() const {
 
 ////////////////////////////////////////////////////////////////////////////////
 char State::piece_at(square_t square) const {
-  uint64_t bboard = BBOARD(square);
-  if (bboard & presence) {
-    if (bboard & pawns) {
-      return 'p';
-    } else if (bboard & rooks) {
-      return bboard & bishops ? 'q' : 'r';
-    } else if (bboard & bishops) {
-      return bboard & rooks ? 'q' : 'b';
-    } else if (bboard & knights) {
-      return 'n';
-    }
-    return 'k';
-  } else {
-    return '\0';
-  }
+  return board[square];
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-char State::remove_from_piece_list(square_t square) {
-  Piece *p = pieces;
-  for (int i = 0; i < npieces; i += 1) {
-    /* find the item to be removed */
-    if (pieces[i].square == square) {
-      /* decrement piece count */
-      npieces -= 1;
-      /* if it was not the last item */
-      if (i < npieces) {
-        /* copy last item */
-        pieces[i].name = pieces[npieces].name;
-        pieces[i].square = pieces[npieces].square;
-      }
-      /* remove the last item */
-      char oldpiece = pieces[npieces].name;
-      pieces[npieces].name = '\0';
-      return oldpiece;
-    }
+uint64_t State::compute_attack(const State &opponent, bool im_white) const {
+
+  const uint64_t occupied = presence | opponent.presence;
+  uint64_t west, east;
+  if (im_white) {
+    pawn_attacks<true>(pawns, west, east);
+  } else {
+    pawn_attacks<false>(pawns, west, east);
   }
-  return '\0';
-}
+  uint64_t a = west | east | (king ? KING_CAPTURES[lsb(king)] : 0);
 
-template <const bboard_and_square_t ray[64][8]>
-inline uint64_t ray_attack(const uint64_t occupied, const int offset) {
-  uint64_t a = 0;
-  auto ptr = ray[offset];
-  while (ptr->bboard) {
-    a = a | ptr->bboard;
-    if (ptr->bboard & occupied) {
-      break;
-    }
-    ptr += 1;
+  for (uint64_t b = knights; b;) {
+    a |= KNIGHT_CAPTURES[pop_lsb(b)];
+  }
+  for (uint64_t b = diagonal_sliders(); b;) {
+    a |= bishop_attacks(pop_lsb(b), occupied);
+  }
+  for (uint64_t b = orthogonal_sliders(); b;) {
+    a |= rook_attacks(pop_lsb(b), occupied);
   }
   return a;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-uint64_t State::compute_attack(const State &opponent, bool im_white) const {
+uint64_t State::attackers_to(int offset, uint64_t occupied,
+                             bool im_white) const {
+  /* a piece attacks the square if the same kind of piece standing on the
+   * square would attack it back */
+  return ((im_white ? BLACK_PAWN_CAPTURES : WHITE_PAWN_CAPTURES)[offset] &
+          pawns) |
+         (KNIGHT_CAPTURES[offset] & knights) | (KING_CAPTURES[offset] & king) |
+         (rook_attacks(offset, occupied) & orthogonal_sliders()) |
+         (bishop_attacks(offset, occupied) & diagonal_sliders());
+}
 
-  const uint64_t occupied = presence | opponent.presence;
-  uint64_t a = 0;
-  const Piece *p = pieces;
-
-  do {
-    int offset = OFFSET(p->square);
-    switch (p->name) {
-    case 'p':
-      a = a | (im_white ? WHITE_PAWN_CAPTURES : BLACK_PAWN_CAPTURES)[offset];
-      break;
-    case 'n':
-      a = a | KNIGHT_CAPTURES[offset];
-      break;
-    case 'k':
-      a = a | KING_CAPTURES[offset];
-      break;
-    case 'r':
-      a = a | ray_attack<ROOK_RAY_N>(occupied, offset);
-      a = a | ray_attack<ROOK_RAY_E>(occupied, offset);
-      a = a | ray_attack<ROOK_RAY_S>(occupied, offset);
-      a = a | ray_attack<ROOK_RAY_W>(occupied, offset);
-      break;
-    case 'q':
-      a = a | ray_attack<ROOK_RAY_N>(occupied, offset);
-      a = a | ray_attack<ROOK_RAY_E>(occupied, offset);
-      a = a | ray_attack<ROOK_RAY_S>(occupied, offset);
-      a = a | ray_attack<ROOK_RAY_W>(occupied, offset);
-      /*nobreak;*/
-    case 'b':
-      a = a | ray_attack<BISHOP_RAY_NE>(occupied, offset);
-      a = a | ray_attack<BISHOP_RAY_SE>(occupied, offset);
-      a = a | ray_attack<BISHOP_RAY_NW>(occupied, offset);
-      a = a | ray_attack<BISHOP_RAY_SW>(occupied, offset);
-      break;
-    }
-    p += 1;
-  } while (p->name);
-  return a;
+////////////////////////////////////////////////////////////////////////////////
+bool State::king_attacked(const State &opponent, bool im_white) const {
+  return king && opponent.attackers_to(lsb(king), presence | opponent.presence,
+                                       !im_white);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 void State::move_piece(char piece, square_t from, square_t to) {
-  Piece *p = pieces;
-  do {
-    if (p->square == from) {
-      p->square = to;
-      const uint64_t mask = ~BBOARD(from);
-      const uint64_t bboard_to = BBOARD(to);
-      presence = (presence & mask) | bboard_to;
-      switch (piece) {
-      case 'r':
-        rooks = (rooks & mask) | bboard_to;
-        break;
-      case 'n':
-        knights = (knights & mask) | bboard_to;
-        break;
-      case 'q':
-        rooks = (rooks & mask) | bboard_to; /*nobreak;*/
-      case 'b':
-        bishops = (bishops & mask) | bboard_to;
-        break;
-      case 'k':
-        king = bboard_to;
-        break;
-      case 'p':
-        pawns = (pawns & mask) | bboard_to;
-        break;
-      }
-      return;
-    }
-    p += 1;
-  } while (p->name);
+  const uint64_t from_to = BBOARD(from) | BBOARD(to);
+  presence ^= from_to;
+  bitboard(piece) ^= from_to;
+  board[to] = piece;
+  board[from] = '\0';
+  const int index = psq_index(piece);
+  mg += PSQ_MG[index][to ^ psq_flip] - PSQ_MG[index][from ^ psq_flip];
+  eg += PSQ_EG[index][to ^ psq_flip] - PSQ_EG[index][from ^ psq_flip];
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 void State::remove_piece(square_t square) {
+  update_psq(board[square], square, -1);
   const uint64_t mask = ~BBOARD(square);
   presence &= mask;
-  switch (remove_from_piece_list(square)) {
-  case 'q':
-    rooks &= mask;
-    bishops &= mask;
-    return;
-  case 'p':
-    pawns &= mask;
-    return;
-  case 'r':
-    rooks &= mask;
-    return;
-  case 'n':
-    knights &= mask;
-    return;
-  case 'b':
-    bishops &= mask;
-    return;
-  default:
-    king &= mask;
-  }
+  bitboard(board[square]) &= mask;
+  board[square] = '\0';
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void State::update_for_capture(const Move &move, bool white) {
+template <Color Us> void State::update_for_capture(const Move &move) {
   if (move.enpassant) {
     int col = COL(move.to);
-    int capture_row = white ? ROW(move.to) + 1 : ROW(move.to) - 1;
-    square_t dest = SQUARE(capture_row, col);
-    const uint64_t mask = ~BBOARD(dest);
-    presence &= mask;
-    pawns &= mask;
-    remove_from_piece_list(dest);
+    int capture_row = Us == WHITE ? ROW(move.to) + 1 : ROW(move.to) - 1;
+    remove_piece(SQUARE(capture_row, col));
   } else {
     remove_piece(move.to);
   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void State::update_for_move(const Move &move, bool white,
-                            StateUpdateResult &result) {
+template <Color Us>
+void State::update_for_move(const Move &move, StateUpdateResult &result) {
+  constexpr int castling_row = Us == WHITE ? 0 : 7;
+
   /* move the rooks when castling */
   if (move.kingside_castling) {
-    const int castling_row = white ? 0 : 7;
     move_piece('r', SQUARE(castling_row, 7), SQUARE(castling_row, 5));
   } else if (move.queenside_castling) {
-    const int castling_row = white ? 0 : 7;
     move_piece('r', SQUARE(castling_row, 0), SQUARE(castling_row, 3));
   }
 
@@ -412,8 +392,7 @@ void State::update_for_move(const Move &move, bool white,
     result.castling_rights.kingside = false;
     result.castling_rights.queenside = false;
   } else if (move.piece == 'r') {
-    int from_row = ROW(move.from);
-    if (from_row == (white ? 0 : 7)) {
+    if (ROW(move.from) == castling_row) {
       int from_col = COL(move.from);
       if (from_col == 0) {
         result.castling_rights.queenside = false;
@@ -433,160 +412,22 @@ void State::update_for_move(const Move &move, bool white,
 
   /* set enpassant if applicable */
   if (move.pawn_jumstart) {
-    result.enpassant = BBOARD(SQUARE(white ? 2 : 5, COL(move.from)));
+    result.enpassant = BBOARD(SQUARE(Us == WHITE ? 2 : 5, COL(move.from)));
   } else {
     result.enpassant = 0;
   }
 }
 
 BoardState::BoardState()
-    : z(0), enpassant(0), halfmoves(0), moves(0), white_to_move(0) {}
+    : history{}, plies(0), plies_from_null(0), z(0), pawn_key(0),
+      material_key(0), enpassant(0), halfmoves(0), moves(0), white(true),
+      black(false), white_to_move(0) {}
 
 ////////////////////////////////////////////////////////////////////////////////
 BoardState BoardState::initial() {
   return from_fen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
 }
 
-////////////////////////////////////////////////////////////////////////////////
-BoardState BoardState::from_fen(const string &fen) {
-  BoardState self;
-  State *current;
-
-  vector<string> items = StringUtils::split(fen, ' ');
-
-  if (items.size() != 6) {
-    throw invalid_argument("invalid fen");
-  }
-
-  /* positions */
-  string positions = items[0];
-  int row = 7;
-  int col = 0;
-  for (int i = 0, len = positions.length(); i < len; i += 1) {
-    char c = positions[i];
-    if (c == '/') {
-      row = row - 1;
-      col = 0;
-      continue;
-    }
-    if (c >= '0' && c <= '8') {
-      col = col + (c - '0');
-      continue;
-    }
-    char piece = tolower(c);
-    current = piece == c ? &self.black : &self.white;
-    current->enplace(piece, SQUARE(row, col));
-    col += 1;
-  }
-
-  /* turn */
-  string turn = items[1];
-  self.white_to_move = turn[0] == 'w';
-
-  /* moves */
-  string moves = items[5];
-  self.moves = stoi(moves);
-
-  /* castlings */
-  string castlings = items[2];
-  self.white_castling.kingside = castlings.find('K') != string::npos;
-  self.white_castling.queenside = castlings.find('Q') != string::npos;
-  self.black_castling.kingside = castlings.find('k') != string::npos;
-  self.black_castling.queenside = castlings.find('q') != string::npos;
-
-  /* enpassant */
-  string enpassant = items[3];
-  if (enpassant[0] == '-') {
-    self.enpassant = 0;
-  } else {
-    int col = enpassant[0] - 'a';
-    int row = enpassant[1] - '1';
-    self.enpassant = BBOARD(SQUARE(row, col));
-  }
-
-  /* halfmoves */
-  string halfmoves = items[4];
-  self.halfmoves = stoi(halfmoves);
-
-  self.recompute_z();
-  return self;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-string BoardState::to_fen() const {
-  string fen;
-  fen.reserve(128);
-  /* position */
-  for (int row = 7; row >= 0; row -= 1) {
-    if (row < 7) {
-      fen += '/';
-    }
-    int empty = 0;
-    for (int col = 0; col < 8; col += 1) {
-      char p = piece_at(SQUARE(row, col));
-      if (p == '\0') {
-        empty += 1;
-      } else {
-        if (empty > 0) {
-          fen += to_string(empty);
-          empty = 0;
-        }
-        fen += p;
-      }
-    }
-    if (empty > 0) {
-      fen += to_string(empty);
-    }
-  }
-
-  /* current player */
-  fen += ' ';
-  fen += white_to_move ? 'w' : 'b';
-
-  /* castlings */
-  fen += ' ';
-  bool has_castlings = false;
-  if (white_castling.kingside) {
-    fen += 'K';
-    has_castlings = true;
-  }
-  if (white_castling.queenside) {
-    fen += 'Q';
-    has_castlings = true;
-  }
-  if (black_castling.kingside) {
-    fen += 'k';
-    has_castlings = true;
-  }
-  if (black_castling.queenside) {
-    fen += 'q';
-    has_castlings = true;
-  }
-  if (!has_castlings) {
-    fen += '-';
-  }
-
-  /* enpassant */
-  fen += ' ';
-  if (enpassant) {
-    square_t e = square_for_bboard(enpassant);
-    fen += abcdefgh[COL(e)];
-    fen += to_string(1 + ROW(e));
-  } else {
-    fen += '-';
-  }
-
-  /* half moves */
-  fen += ' ';
-  fen += to_string(halfmoves);
-
-  /* moves */
-  fen += ' ';
-  fen += to_string(moves);
-
-  return fen;
-}
-
 ////////////////////////////////////////////////////////////////////////////////
 string BoardState::to_str() const {
   string s;
@@ -613,164 +454,254 @@ char BoardState::piece_at(square_t square) const {
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+Move BoardState::move_from_short(uint16_t code) const {
+  Move move;
+  move.from = code & 0x3f;
+  move.to = (code >> 6) & 0x3f;
+  const int prom = (code >> 12) & 0x7;
+  if (prom > 4 || (code >> 15)) {
+    return move;
+  }
+  move.promotion = prom ? code_piece[prom + 1] : '\0';
+
+  const State &moving = white_to_move ? white : black;
+  const State &opponent = white_to_move ? black : white;
+  move.piece = moving.piece_at(move.from);
+  move.captured = opponent.piece_at(move.to);
+
+  if (move.piece == 'p') {
+    const int drow = (int)ROW(move.to) - (int)ROW(move.from);
+    move.pawn_jumstart = drow == 2 || drow == -2;
+    if (COL(move.from) != COL(move.to) && BBOARD(move.to) == enpassant) {
+      move.enpassant = true;
+      move.captured = 'p';
+    }
+  } else if (move.piece == 'k') {
+    const int dcol = (int)COL(move.to) - (int)COL(move.from);
+    move.kingside_castling = dcol == 2;
+    move.queenside_castling = dcol == -2;
+  }
+  return move;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 StateUpdateResult::StateUpdateResult(const Castling &castling)
     : castling_rights(castling), enpassant(0) {}
 
 ////////////////////////////////////////////////////////////////////////////////
 bool BoardState::make_move(const Move &move) {
-  State *moving;
-  State *opponent;
-  Castling *castling;
-  bool opponent_is_white;
+  const Memento saved = memento();
+  make_legal_move(move);
 
+  /* the side that has just played must not have left its king in check */
+  if (white_to_move ? black.king_attacked(white, false)
+                    : white.king_attacked(black, true)) {
+    unmake_move(move, saved);
+    return false;
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void BoardState::make_legal_move(const Move &move) {
   if (white_to_move) {
-    moving = &white;
-    opponent = &black;
-    castling = &white_castling;
-    opponent_is_white = false;
+    make_legal_move<WHITE>(move);
   } else {
-    moving = &black;
-    opponent = &white;
-    castling = &black_castling;
-    opponent_is_white = true;
+    make_legal_move<BLACK>(move);
   }
+}
 
-  /* save the states if we have to revert later */
-  const State saved_white = white;
-  const State saved_black = black;
+////////////////////////////////////////////////////////////////////////////////
+template <Color Us> void BoardState::make_legal_move(const Move &move) {
+  constexpr Color Them = Us == WHITE ? BLACK : WHITE;
+  State &moving = Us == WHITE ? white : black;
+  State &opponent = Us == WHITE ? black : white;
+  Castling &castling = Us == WHITE ? white_castling : black_castling;
+  Castling &opponent_castling = Us == WHITE ? black_castling : white_castling;
+
+  push_history();
+  plies_from_null += 1;
+
+  const Castling previous_white_castling = white_castling;
+  const Castling previous_black_castling = black_castling;
+  int previous_halfmoves = halfmoves;
+  // used to incremental zobrist hash computation
+  const uint64_t previous_enpassant = hashed_enpassant<Us>();
 
   /* update the state for the moving side */
-  StateUpdateResult moveresult(*castling);
-  moving->update_for_move(move, !opponent_is_white, moveresult);
+  StateUpdateResult moveresult(castling);
+  moving.update_for_move<Us>(move, moveresult);
 
   /* update the opponents pieces if this is a capture */
   if (move.captured) {
-    opponent->update_for_capture(move, opponent_is_white);
+    opponent.update_for_capture<Them>(move);
+  }
+
+  enpassant = moveresult.enpassant;
+  castling = moveresult.castling_rights;
+
+  /* capturing a rook on its initial square removes the castling right on
+   * that side */
+  if (move.captured == 'r') {
+    constexpr int row = Them == WHITE ? 0 : 7;
+    if (move.to == SQUARE(row, 7)) {
+      opponent_castling.kingside = false;
+    } else if (move.to == SQUARE(row, 0)) {
+      opponent_castling.queenside = false;
+    }
   }
 
-  /* checks which squares are attacked now */
-  uint64_t attacked = opponent->compute_attack(*moving, opponent_is_white);
-  if (moving->king & attacked) {
+  white_to_move = Us == BLACK;
+  if (Us == BLACK) {
+    moves += 1;
+  }
 
-    // Oops, the move is illegal, we gotta to revert
-    white = saved_white;
-    black = saved_black;
-    return false;
+  if (move.piece == 'p' || move.captured) {
+    halfmoves = 0;
   } else {
+    halfmoves += 1;
+  }
 
-    Castling previous_castling;
-    int previous_halfmoves = halfmoves;
-    uint64_t previous_enpassant =
-        enpassant; // used to incremental zobrist hash computation
-
-    enpassant = moveresult.enpassant;
-    if (white_to_move) {
-      previous_castling = white_castling;
-      white_castling = moveresult.castling_rights;
-
-      // we should not consider the enpassant for zobrist
-      // hash computation if it was not possible to actually do the enpassant
-      // capture
-      if (previous_enpassant) {
-        square_t ep = square_for_bboard(previous_enpassant);
-        if (!(BLACK_PAWN_CAPTURES[OFFSET(ep)] & saved_white.pawns)) {
-          previous_enpassant = 0;
-        }
-      }
+  evolve_z<Us>(move, previous_white_castling, previous_black_castling,
+               previous_halfmoves, previous_enpassant);
+}
 
-      white_to_move = false;
-    } else {
-      previous_castling = black_castling;
-      black_castling = moveresult.castling_rights;
-
-      // we should not consider the enpassant for zobrist
-      // hash computation if it was not possible to actually do the enpassant
-      // capture
-      if (previous_enpassant) {
-        square_t ep = square_for_bboard(previous_enpassant);
-        if (!(WHITE_PAWN_CAPTURES[OFFSET(ep)] & saved_black.pawns)) {
-          previous_enpassant = 0;
-        }
-      }
-      white_to_move = true;
-      moves += 1;
-    }
+////////////////////////////////////////////////////////////////////////////////
+template <Color Us> uint64_t BoardState::hashed_enpassant() const {
+  // we should not consider the enpassant for zobrist
+  // hash computation if it was not possible to actually do the enpassant
+  // capture
+  const State &moving = Us == WHITE ? white : black;
+  if (enpassant && ((Us == WHITE ? BLACK_PAWN_CAPTURES
+                                 : WHITE_PAWN_CAPTURES)[lsb(enpassant)] &
+                    moving.pawns)) {
+    return enpassant;
+  }
+  return 0;
+}
 
-    if (move.piece == 'p' || move.captured) {
-      halfmoves = 0;
-    } else {
-      halfmoves += 1;
-    }
+////////////////////////////////////////////////////////////////////////////////
+void BoardState::make_null_move() {
+  const uint64_t previous_enpassant =
+      white_to_move ? hashed_enpassant<WHITE>() : hashed_enpassant<BLACK>();
+  push_history();
+  plies_from_null = 0;
+  enpassant = 0;
+  halfmoves += 1;
+  if (!white_to_move) {
+    moves += 1;
+  }
+  white_to_move = !white_to_move;
+  evolve_z_null_move(previous_enpassant);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void BoardState::unmake_null_move(const Memento &memento) {
+  white_to_move = !white_to_move;
+  if (!white_to_move) {
+    moves -= 1;
+  }
+  plies -= 1;
+  plies_from_null = memento.plies_from_null;
+  halfmoves = memento.halfmoves;
+  enpassant = memento.enpassant;
+  z = memento.z;
+  pawn_key = memento.pawn_key;
+  material_key = memento.material_key;
+}
 
-    evolve_z(move, previous_castling, previous_halfmoves, previous_enpassant);
+////////////////////////////////////////////////////////////////////////////////
+void BoardState::push_history() {
+  history[plies & (HISTORY_SIZE - 1)] = z;
+  plies += 1;
+}
 
-    return true;
+////////////////////////////////////////////////////////////////////////////////
+bool BoardState::is_repetition(int count, int ply) const {
+  /* a position can only repeat one with the same side to move, at least 4
+   * plies ago */
+  const int end = min(min(halfmoves, plies_from_null), HISTORY_SIZE - 1);
+  for (int i = 4; i <= end; i += 2) {
+    if (history[(plies - i) & (HISTORY_SIZE - 1)] == z &&
+        (i < ply || --count == 0)) {
+      return true;
+    }
   }
+  return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+bool BoardState::is_fifty_moves() const { return halfmoves >= 100; }
+
 ////////////////////////////////////////////////////////////////////////////////
 Memento BoardState::memento() const {
   Memento m;
-  m.castling = white_to_move ? white_castling : black_castling;
+  m.white_castling = white_castling;
+  m.black_castling = black_castling;
   m.halfmoves = halfmoves;
+  m.plies_from_null = plies_from_null;
   m.enpassant = enpassant;
   m.z = z;
+  m.pawn_key = pawn_key;
+  m.material_key = material_key;
   return m;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 void BoardState::unmake_move(const Move &move, const Memento &memento) {
-  State *hasplayed;
-  State *opponent;
-  Castling *castling;
-
+  /* the side that has played the move is not the side to move */
   if (white_to_move) {
-    hasplayed = &black;
-    opponent = &white;
-    castling = &black_castling;
-    moves -= 1;
+    unmake_move<BLACK>(move, memento);
   } else {
-    hasplayed = &white;
-    opponent = &black;
-    castling = &white_castling;
+    unmake_move<WHITE>(move, memento);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <Color Us>
+void BoardState::unmake_move(const Move &move, const Memento &memento) {
+  State &hasplayed = Us == WHITE ? white : black;
+  State &opponent = Us == WHITE ? black : white;
+  constexpr int row = Us == WHITE ? 0 : 7;
+
+  if (Us == BLACK) {
+    moves -= 1;
   }
 
   if (move.captured) {
     if (move.enpassant) {
-      int row = hasplayed == &white ? 4 : 3;
-      opponent->enplace('p', SQUARE(row, COL(move.to)));
+      opponent.enplace('p', SQUARE(Us == WHITE ? 4 : 3, COL(move.to)));
     } else {
-      opponent->enplace(move.captured, move.to);
+      opponent.enplace(move.captured, move.to);
     }
   }
 
   if (move.promotion) {
-    hasplayed->remove_piece(move.to);
-    hasplayed->enplace('p', move.from);
+    hasplayed.remove_piece(move.to);
+    hasplayed.enplace('p', move.from);
   } else {
-    hasplayed->move_piece(move.piece, move.to, move.from);
+    hasplayed.move_piece(move.piece, move.to, move.from);
   }
 
   if (move.kingside_castling) {
-    int row = hasplayed == &white ? 0 : 7;
-    hasplayed->move_piece('r', SQUARE(row, 5), SQUARE(row, 7));
+    hasplayed.move_piece('r', SQUARE(row, 5), SQUARE(row, 7));
   } else if (move.queenside_castling) {
-    int row = hasplayed == &white ? 0 : 7;
-    hasplayed->move_piece('r', SQUARE(row, 3), SQUARE(row, 0));
+    hasplayed.move_piece('r', SQUARE(row, 3), SQUARE(row, 0));
   }
 
-  if (white_to_move) {
-    white_to_move = false;
-    black_castling = memento.castling;
-  } else {
-    white_to_move = true;
-    white_castling = memento.castling;
-  }
+  white_to_move = Us == WHITE;
+  plies -= 1;
+  plies_from_null = memento.plies_from_null;
+
+  white_castling = memento.white_castling;
+  black_castling = memento.black_castling;
 
   halfmoves = memento.halfmoves;
   enpassant = memento.enpassant;
   z = memento.z;
+  pawn_key = memento.pawn_key;
+  material_key = memento.material_key;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -787,13 +718,8 @@ uint64_t BoardState::get_enpassant() const { return enpassant; }
 
 ////////////////////////////////////////////////////////////////////////////////
 bool BoardState::is_check() const {
-  if (white_to_move) {
-    uint64_t attacked = black.compute_attack(white, false);
-    return white.king & attacked;
-  } else {
-    uint64_t attacked = white.compute_attack(black, true);
-    return black.king & attacked;
-  }
+  return white_to_move ? white.king_attacked(black, true)
+                       : black.king_attacked(white, false);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -801,306 +727,736 @@ PiecesCount BoardState::count_pieces() const {
   PiecesCount pc;
   pc.white_knights = popcnt64(white.knights);
   pc.white_pawns = popcnt64(white.pawns);
-  pc.white_queens = popcnt64(white.rooks & white.bishops);
-  pc.white_rooks = popcnt64(white.rooks) - pc.white_queens;
-  pc.white_bishops = popcnt64(white.knights) - pc.white_queens;
+  pc.white_queens = popcnt64(white.queens);
+  pc.white_rooks = popcnt64(white.rooks);
+  pc.white_bishops = popcnt64(white.bishops);
 
   pc.black_knights = popcnt64(black.knights);
   pc.black_pawns = popcnt64(black.pawns);
-  pc.black_queens = popcnt64(black.rooks & black.bishops);
-  pc.black_rooks = popcnt64(black.rooks) - pc.black_queens;
-  pc.black_bishops = popcnt64(black.knights) - pc.black_queens;
+  pc.black_queens = popcnt64(black.queens);
+  pc.black_rooks = popcnt64(black.rooks);
+  pc.black_bishops = popcnt64(black.bishops);
   return pc;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+int BoardState::psq_score() const {
+  const int phase = min(white.phase + black.phase, PSQ_MAX_PHASE);
+  return ((white.mg - black.mg) * phase +
+          (white.eg - black.eg) * (PSQ_MAX_PHASE - phase)) /
+         PSQ_MAX_PHASE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 uint64_t BoardState::get_zobrist_hash() const { return z; }
 
+////////////////////////////////////////////////////////////////////////////////
+uint64_t BoardState::get_pawn_key() const { return pawn_key; }
+
+////////////////////////////////////////////////////////////////////////////////
+uint64_t BoardState::get_material_key() const { return material_key; }
+
 ////////////////////////////////////////////////////////////////////////////////
 ostream &operator<<(ostream &os, const BoardState &boardstate) {
   os << boardstate.to_str();
   return os;
 }
 
-template <const bboard_and_square_t ray[64][8]>
-inline void branch_move(vector<Move> &moves, const Piece *piece,
-                        const State *moving, const State *opponent,
+/* the moves of a piece to each of the targets */
+inline void piece_moves(MoveList &moves, char piece, int from,
+                        uint64_t targets, const State *opponent,
                         const uint64_t opponent_capturable) {
-  const bboard_and_square_t *r = ray[OFFSET(piece->square)];
-  while (r->bboard) {
-    if (r->bboard & moving->presence)
-      break;
+  while (targets) {
+    const int to = pop_lsb(targets);
     Move move;
-    move.piece = piece->name;
-    move.from = piece->square;
-    move.to = r->square;
-    move.captured =
-        r->bboard & opponent_capturable ? opponent->piece_at(move.to) : '\0';
+    move.piece = piece;
+    move.from = from;
+    move.to = to;
+    move.captured = (((uint64_t)1) << to) & opponent_capturable
+                        ? opponent->board[to]
+                        : '\0';
     moves.push_back(move);
-    if (move.captured)
-      break;
-    r += 1;
-  }
-}
-
-template <const bboard_and_square_t ray0[64][8],
-          const bboard_and_square_t ray1[64][8],
-          const bboard_and_square_t ray2[64][8],
-          const bboard_and_square_t ray3[64][8]>
-inline void ray_moves(vector<Move> &moves, const Piece *piece,
-                      const State *moving, const State *opponent,
-                      const uint64_t opponent_capturable) {
-  branch_move<ray0>(moves, piece, moving, opponent, opponent_capturable);
-  branch_move<ray1>(moves, piece, moving, opponent, opponent_capturable);
-  branch_move<ray2>(moves, piece, moving, opponent, opponent_capturable);
-  branch_move<ray3>(moves, piece, moving, opponent, opponent_capturable);
-}
-
-template <int pawn_direction, int dir>
-inline void pawn_capture(vector<Move> &moves, const Piece *piece,
-                         const State *opponent,
-                         const uint64_t opponent_capturable,
-                         const uint64_t enpassant, const int dest_row) {
-  const square_t dest_square =
-      SQUARE(ROW(piece->square) + pawn_direction, COL(piece->square) + dir);
-  const uint64_t dest = BBOARD(dest_square);
-  if (dest & (opponent_capturable | enpassant)) {
-    if (dest_row != (pawn_direction == 1 ? 7 : 0)) {
-      Move move;
-      move.piece = 'p';
-      move.from = piece->square;
-      move.to = dest_square;
-      if ((move.enpassant = (dest == enpassant))) {
-        move.captured = 'p';
-      } else {
-        move.captured = opponent->piece_at(dest_square);
+  }
+}
+
+/* the pawn moves to each of the targets, the pawns coming from target - delta.
+ * The moves to the last rank are promotions */
+inline void pawn_moves(MoveList &moves, uint64_t targets, int delta,
+                       const State *opponent, uint64_t last_rank) {
+  while (targets) {
+    const int to = pop_lsb(targets);
+    Move move;
+    move.piece = 'p';
+    move.from = to - delta;
+    move.to = to;
+    move.captured = opponent->board[to];
+    move.pawn_jumstart = delta == 16 || delta == -16;
+    if ((((uint64_t)1) << to) & last_rank) {
+      for (int i = 0; i < 4; i += 1) {
+        move.promotion = "qnrb"[i];
+        moves.push_back(move);
       }
-      moves.push_back(move);
     } else {
-      char captured = opponent->piece_at(dest_square);
-      for (int i = 0; i < 4; i += 1) {
+      moves.push_back(move);
+    }
+  }
+}
+
+/* all the pawn moves at once : the pawns bitboard is shifted towards the
+ * destinations, masked, and the destinations are then serialized */
+template <bool white>
+inline void pawn_moves(MoveList &moves, uint64_t pawns, const State *opponent,
+                       uint64_t occupied, uint64_t targets,
+                       uint64_t pawn_capturable, uint64_t enpassant_target,
+                       bool captures, bool quiets) {
+  const int forward = white ? 8 : -8;
+  const uint64_t last_rank = white ? RANK_8 : RANK_1;
+  const uint64_t push = pawn_pushes<white>(pawns) & ~occupied;
+  uint64_t west, east;
+  pawn_attacks<white>(pawns, west, east);
+
+  if (captures) {
+    /* promotions are generated along with the captures */
+    pawn_moves(moves, push & targets & last_rank, forward, opponent,
+               last_rank);
+    pawn_moves(moves, west & pawn_capturable, white ? 7 : -9, opponent,
+               last_rank);
+    pawn_moves(moves, east & pawn_capturable, white ? 9 : -7, opponent,
+               last_rank);
+    if (enpassant_target & (west | east)) {
+      const int to = lsb(enpassant_target);
+      const uint64_t from =
+          pawns & (white ? BLACK_PAWN_CAPTURES : WHITE_PAWN_CAPTURES)[to];
+      for (uint64_t b = from; b;) {
         Move move;
         move.piece = 'p';
-        move.from = piece->square;
-        move.to = dest_square;
-        move.captured = captured;
-        move.promotion = "qnrb"[i];
+        move.from = pop_lsb(b);
+        move.to = to;
+        move.captured = 'p';
+        move.enpassant = true;
         moves.push_back(move);
       }
     }
   }
+
+  if (quiets) {
+    const uint64_t jump =
+        pawn_pushes<white>(push & (white ? RANK_3 : RANK_6)) & ~occupied;
+    pawn_moves(moves, push & targets & ~last_rank, forward, opponent, 0);
+    pawn_moves(moves, jump & targets, 2 * forward, opponent, 0);
+  }
+}
+
+/* the number of moves of pawn_moves(), the enpassant captures aside : a move
+ * to the last rank counts for its 4 promotions */
+template <bool white>
+inline int count_pawn_moves(uint64_t pawns, uint64_t occupied,
+                            uint64_t targets, uint64_t pawn_capturable) {
+  const uint64_t last_rank = white ? RANK_8 : RANK_1;
+  const uint64_t push = pawn_pushes<white>(pawns) & ~occupied;
+  const uint64_t jump =
+      pawn_pushes<white>(push & (white ? RANK_3 : RANK_6)) & ~occupied;
+  uint64_t west, east;
+  pawn_attacks<white>(pawns, west, east);
+  const uint64_t single = push & targets;
+  west &= pawn_capturable;
+  east &= pawn_capturable;
+  return popcnt64(single) + popcnt64(jump & targets) + popcnt64(west) +
+         popcnt64(east) +
+         3 * (popcnt64(single & last_rank) + popcnt64(west & last_rank) +
+              popcnt64(east & last_rank));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 vector<Move> BoardState::generate_moves() const {
+  MoveList moves;
+  generate_moves(moves);
+  return vector<Move>(moves.begin(), moves.end());
+}
 
-  vector<Move> moves;
-  const State *moving;
-  const State *opponent;
-  bool opponent_is_white;
-
-  int count = 0;
-  int initial_row;
-  int pawn_row;
-  int promotion_row;
-  int pawn_direction;
+////////////////////////////////////////////////////////////////////////////////
+void BoardState::generate_moves(MoveList &moves) const {
+  generate_moves(moves, ~((uint64_t)0), GEN_ALL);
+}
 
-  const Castling *castling = &white_castling;
+////////////////////////////////////////////////////////////////////////////////
+void BoardState::generate_moves(MoveList &moves, uint64_t targets,
+                                int kinds) const {
   if (white_to_move) {
-    castling = &white_castling;
-    moving = &white;
-    opponent = &black;
-    opponent_is_white = false;
-    initial_row = 0;
-    pawn_row = 1;
-    promotion_row = 7;
-    pawn_direction = 1;
+    generate_moves<WHITE>(moves, targets, kinds);
   } else {
-    castling = &black_castling;
-    moving = &black;
-    opponent = &white;
-    opponent_is_white = true;
-    initial_row = 7;
-    pawn_row = 6;
-    promotion_row = 0;
-    pawn_direction = -1;
+    generate_moves<BLACK>(moves, targets, kinds);
   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <Color Us>
+void BoardState::generate_moves(MoveList &moves, uint64_t targets,
+                                int kinds) const {
+
+  const State *moving = Us == WHITE ? &white : &black;
+  const State *opponent = Us == WHITE ? &black : &white;
+  const Castling *castling = Us == WHITE ? &white_castling : &black_castling;
+  constexpr bool opponent_is_white = Us == BLACK;
+  constexpr int initial_row = Us == WHITE ? 0 : 7;
 
   const uint64_t opponent_capturable = opponent->presence & ~(opponent->king);
   const uint64_t occupied = moving->presence | opponent->presence;
+  const bool captures = kinds & GEN_CAPTURES;
+  const bool quiets = kinds & GEN_QUIETS;
+
+  /* squares the king may go to, and the other pieces */
+  const uint64_t king_destinations =
+      (captures ? opponent_capturable : 0) | (quiets ? ~occupied : 0);
+  const uint64_t destinations = king_destinations & targets;
+
+  const uint64_t pawn_capturable = captures ? opponent_capturable & targets : 0;
+
+  /* the enpassant capture is allowed if it lands on a target, or if it
+   * removes a target (the pawn that gives check) */
+  const uint64_t enpassant_target =
+      captures ? enpassant & (targets | (Us == WHITE ? targets << 8
+                                                     : targets >> 8))
+               : 0;
+
+  /* pawns */
+  pawn_moves<Us == WHITE>(moves, moving->pawns, opponent, occupied, targets,
+                          pawn_capturable, enpassant_target, captures,
+                          quiets);
+
+  /* knights */
+  for (uint64_t knights = moving->knights; knights;) {
+    const int from = pop_lsb(knights);
+    piece_moves(moves, 'n', from, KNIGHT_CAPTURES[from] & destinations,
+                opponent, opponent_capturable);
+  }
 
-  const Piece *p = moving->pieces;
-
-  do {
-
-    int from_row = ROW(p->square), from_col = COL(p->square);
-    int from_offset = OFFSET(p->square);
-    switch (p->name) {
-
-    case 'n': {
-      const bboard_and_square_t *s = KNIGHT_MOVES[from_offset];
-      for (int i = 0; i < 8 && s->bboard; i += 1) {
-        if (s->bboard & ~moving->presence) {
-          Move move;
-          move.from = p->square;
-          move.to = s->square;
-          move.piece = 'n';
-          move.captured = s->bboard & opponent_capturable
-                              ? opponent->piece_at(move.to)
-                              : '\0';
-          moves.push_back(move);
-        }
-        s += 1;
-      }
-    } break;
-
-    case 'k': {
-
-      uint64_t attacked = opponent->compute_attack(*moving, opponent_is_white);
-      const bboard_and_square_t *s = KING_MOVES[from_offset];
-      const uint64_t notok_squares = moving->presence | attacked;
-
-      for (int i = 0; i < 8 && s->bboard; i += 1) {
-        if (s->bboard & ~notok_squares) {
-          Move move;
-          move.piece = 'k';
-          move.from = p->square;
-          move.to = s->square;
-          move.captured = s->bboard & opponent_capturable
-                              ? opponent->piece_at(move.to)
-                              : '\0';
-          moves.push_back(move);
-        }
-        s += 1;
-      }
+  /* sliders */
+  for (uint64_t bishops = moving->bishops; bishops;) {
+    const int from = pop_lsb(bishops);
+    piece_moves(moves, 'b', from,
+                bishop_attacks(from, occupied) & destinations, opponent,
+                opponent_capturable);
+  }
+  for (uint64_t rooks = moving->rooks; rooks;) {
+    const int from = pop_lsb(rooks);
+    piece_moves(moves, 'r', from, rook_attacks(from, occupied) & destinations,
+                opponent, opponent_capturable);
+  }
+  for (uint64_t queens = moving->queens; queens;) {
+    const int from = pop_lsb(queens);
+    piece_moves(moves, 'q', from,
+                queen_attacks(from, occupied) & destinations, opponent,
+                opponent_capturable);
+  }
 
-      /* castling */
-      if (BBOARD(p->square) & ~attacked) {
-
-#define OCCUPIED_OR_ATTACKED(col)                                              \
-  (BBOARD(SQUARE(initial_row, col)) & (opponent->presence | notok_squares))
-
-#define OCCUPIED(col)                                                          \
-  (BBOARD(SQUARE(initial_row, col)) & (moving->presence | opponent->presence))
-
-        if (castling->kingside &&
-            !(OCCUPIED_OR_ATTACKED(5) || OCCUPIED_OR_ATTACKED(6))) {
-
-          Move move;
-          move.piece = 'k';
-          move.from = SQUARE(initial_row, 4);
-          move.to = SQUARE(initial_row, 6);
-          move.kingside_castling = true;
-          moves.push_back(move);
-        }
-
-        if (castling->queenside && !(OCCUPIED_OR_ATTACKED(3) ||
-                                     OCCUPIED_OR_ATTACKED(2) || OCCUPIED(1))) {
-          Move move;
-          move.piece = 'k';
-          move.from = SQUARE(initial_row, 4);
-          move.to = SQUARE(initial_row, 2);
-          move.queenside_castling = true;
-          moves.push_back(move);
-        }
-
-#undef OCCUPIED_OR_ATTACKED
-#undef OCCUPIED
+  /* king */
+  if (moving->king) {
+    const int from = lsb(moving->king);
+
+    /* the king must not stay on the ray of a slider it is moving away from,
+     * so it is removed from the occupancy */
+    const uint64_t occupied_without_king = occupied & ~moving->king;
+    uint64_t safe = 0;
+    for (uint64_t b = KING_CAPTURES[from] & king_destinations; b;) {
+      const int to = pop_lsb(b);
+      if (!opponent->attackers_to(to, occupied_without_king,
+                                  opponent_is_white)) {
+        safe |= ((uint64_t)1) << to;
       }
-    } break;
-
-    case 'r': {
-      ray_moves<ROOK_RAY_N, ROOK_RAY_E, ROOK_RAY_S, ROOK_RAY_W>(
-          moves, p, moving, opponent, opponent_capturable);
-    } break;
-    case 'b': {
-      ray_moves<BISHOP_RAY_NE, BISHOP_RAY_NW, BISHOP_RAY_SE, BISHOP_RAY_SW>(
-          moves, p, moving, opponent, opponent_capturable);
-    } break;
-    case 'q': {
-      ray_moves<ROOK_RAY_N, ROOK_RAY_E, ROOK_RAY_S, ROOK_RAY_W>(
-          moves, p, moving, opponent, opponent_capturable);
-      ray_moves<BISHOP_RAY_NE, BISHOP_RAY_NW, BISHOP_RAY_SE, BISHOP_RAY_SW>(
-          moves, p, moving, opponent, opponent_capturable);
-    } break;
-    case 'p': {
-
-      int dest_row = from_row + pawn_direction;
-      square_t dest_square = SQUARE(dest_row, from_col);
-      uint64_t dest = BBOARD(dest_square);
-
-      /*non capture moves*/
-      if (dest & ~occupied) {
-
-        /* one step forward */
-        if (dest_row != promotion_row) {
-          Move move;
-          move.piece = 'p';
-          move.from = p->square;
-          move.to = dest_square;
-          moves.push_back(move);
-        } else {
-          /* promotion */
-          for (int i = 0; i < 4; i += 1) {
-            Move move;
-            move.piece = 'p';
-            move.promotion = "qnrb"[i];
-            move.from = p->square;
-            move.to = dest_square;
-            moves.push_back(move);
-          }
-        }
-
-        /* initial move : 2 steps forward */
-        if (from_row == pawn_row) {
-          int jump_dest_row = from_row + pawn_direction * 2;
-          square_t jump_dest = SQUARE(jump_dest_row, from_col);
-          dest = BBOARD(jump_dest);
-          if (dest & ~occupied) {
-            Move move;
-            move.piece = 'p';
-            move.pawn_jumstart = true;
-            move.from = p->square;
-            move.to = jump_dest;
-            moves.push_back(move);
-          }
-        }
+    }
+    piece_moves(moves, 'k', from, safe, opponent, opponent_capturable);
+
+    /* castling */
+    if (quiets && (castling->kingside || castling->queenside)) {
+      const bool in_check =
+          opponent->attackers_to(from, occupied, opponent_is_white);
+
+      if (castling_allowed<Us>(true, occupied, in_check)) {
+        Move move;
+        move.piece = 'k';
+        move.from = SQUARE(initial_row, 4);
+        move.to = SQUARE(initial_row, 6);
+        move.kingside_castling = true;
+        moves.push_back(move);
       }
 
-      /* capture left */
-      if (from_col > 0) {
-        if (white_to_move) {
-          pawn_capture<1, -1>(moves, p, opponent, opponent_capturable,
-                              enpassant, dest_row);
-        } else {
-          pawn_capture<-1, -1>(moves, p, opponent, opponent_capturable,
-                               enpassant, dest_row);
-        }
+      if (castling_allowed<Us>(false, occupied, in_check)) {
+        Move move;
+        move.piece = 'k';
+        move.from = SQUARE(initial_row, 4);
+        move.to = SQUARE(initial_row, 2);
+        move.queenside_castling = true;
+        moves.push_back(move);
       }
+    }
+  }
+}
 
-      /* capture right */
-      if (from_col < 7) {
-        if (white_to_move) {
-          pawn_capture<1, 1>(moves, p, opponent, opponent_capturable, enpassant,
-                             dest_row);
-        } else {
-          pawn_capture<-1, 1>(moves, p, opponent, opponent_capturable,
-                              enpassant, dest_row);
-        }
+////////////////////////////////////////////////////////////////////////////////
+template <Color Us>
+bool BoardState::castling_allowed(bool kingside, uint64_t occupied,
+                                  bool in_check) const {
+  const Castling &castling = Us == WHITE ? white_castling : black_castling;
+  const State &opponent = Us == WHITE ? black : white;
+  constexpr bool opponent_is_white = Us == BLACK;
+  constexpr int initial_row = Us == WHITE ? 0 : 7;
+  const int king = SQUARE(initial_row, 4);
+  const int rook = SQUARE(initial_row, kingside ? 7 : 0);
+  const int step = kingside ? 1 : -1;
+
+  return (kingside ? castling.kingside : castling.queenside) && !in_check &&
+         !(BETWEEN[king][rook] & occupied) &&
+         !opponent.attackers_to(king + step, occupied, opponent_is_white) &&
+         !opponent.attackers_to(king + 2 * step, occupied, opponent_is_white);
+}
+
+/* the pieces (of both sides) standing alone between the square and a slider
+ * of the attacking side : the pinned pieces if the square is the king of the
+ * other side, the pieces that may give a discovered check otherwise */
+static uint64_t slider_blockers(int square, const State &attacking,
+                                uint64_t occupied) {
+  /* sliders that would attack the square on an empty board */
+  uint64_t snipers =
+      (rook_attacks(square, 0) & attacking.orthogonal_sliders()) |
+      (bishop_attacks(square, 0) & attacking.diagonal_sliders());
+  uint64_t result = 0;
+  while (snipers) {
+    const uint64_t between = BETWEEN[square][pop_lsb(snipers)] & occupied;
+    if (between && !(between & (between - 1))) {
+      result |= between;
+    }
+  }
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint64_t BoardState::checkers() const {
+  const State &moving = white_to_move ? white : black;
+  const State &opponent = white_to_move ? black : white;
+  if (!moving.king) {
+    return 0;
+  }
+  return opponent.attackers_to(lsb(moving.king),
+                               moving.presence | opponent.presence,
+                               !white_to_move);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint64_t BoardState::pinned() const {
+  const State &moving = white_to_move ? white : black;
+  const State &opponent = white_to_move ? black : white;
+  if (!moving.king) {
+    return 0;
+  }
+  return slider_blockers(lsb(moving.king), opponent,
+                         moving.presence | opponent.presence) &
+         moving.presence;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+CheckInfo BoardState::check_info() const {
+  const State &moving = white_to_move ? white : black;
+  const State &opponent = white_to_move ? black : white;
+  CheckInfo info;
+  if (!opponent.king) {
+    info.king = -1;
+    info.discoverers = 0;
+    info.pawn_checks = info.knight_checks = 0;
+    info.bishop_checks = info.rook_checks = 0;
+    return info;
+  }
+  const uint64_t occupied = moving.presence | opponent.presence;
+  info.king = lsb(opponent.king);
+  info.discoverers =
+      slider_blockers(info.king, moving, occupied) & moving.presence;
+  info.pawn_checks =
+      (white_to_move ? BLACK_PAWN_CAPTURES : WHITE_PAWN_CAPTURES)[info.king];
+  info.knight_checks = KNIGHT_CAPTURES[info.king];
+  info.bishop_checks = bishop_attacks(info.king, occupied);
+  info.rook_checks = rook_attacks(info.king, occupied);
+  return info;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool BoardState::gives_check(const Move &move) const {
+  return gives_check(move, check_info());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool BoardState::gives_check(const Move &move, const CheckInfo &info) const {
+  if (info.king < 0) {
+    return false;
+  }
+  const State &moving = white_to_move ? white : black;
+  const State &opponent = white_to_move ? black : white;
+  const uint64_t from = BBOARD(move.from);
+  const uint64_t to = BBOARD(move.to);
+
+  /* direct check, from the destination */
+  switch (move.promotion ? move.promotion : move.piece) {
+  case 'p':
+    if (info.pawn_checks & to) {
+      return true;
+    }
+    break;
+  case 'n':
+    if (info.knight_checks & to) {
+      return true;
+    }
+    break;
+  case 'b':
+    if (info.bishop_checks & to) {
+      return true;
+    }
+    break;
+  case 'r':
+    if (info.rook_checks & to) {
+      return true;
+    }
+    break;
+  case 'q':
+    if ((info.bishop_checks | info.rook_checks) & to) {
+      return true;
+    }
+    break;
+  }
+
+  /* discovered check, unless the piece stays on the line */
+  if ((info.discoverers & from) && !(LINE[info.king][move.from] & to)) {
+    return true;
+  }
+
+  const uint64_t occupied = moving.presence | opponent.presence;
+  if (move.promotion) {
+    /* the promoted piece may attack through the square the pawn has left */
+    const uint64_t after = occupied ^ from;
+    switch (move.promotion) {
+    case 'b':
+      return bishop_attacks(move.to, after) & opponent.king;
+    case 'r':
+      return rook_attacks(move.to, after) & opponent.king;
+    case 'q':
+      return queen_attacks(move.to, after) & opponent.king;
+    }
+    return false;
+  }
+
+  if (move.enpassant) {
+    /* the captured pawn may also uncover a slider */
+    const uint64_t captured = BBOARD(white_to_move ? move.to - 8 : move.to + 8);
+    const uint64_t after = (occupied ^ from ^ captured) | to;
+    return (rook_attacks(info.king, after) & moving.orthogonal_sliders()) ||
+           (bishop_attacks(info.king, after) & moving.diagonal_sliders());
+  }
+
+  if (move.kingside_castling || move.queenside_castling) {
+    /* the rook checks from its new square */
+    const int row = ROW(move.from);
+    const int rook_from = SQUARE(row, move.kingside_castling ? 7 : 0);
+    const int rook_to = SQUARE(row, move.kingside_castling ? 5 : 3);
+    const uint64_t after =
+        (occupied ^ from ^ BBOARD(rook_from)) | to | BBOARD(rook_to);
+    return rook_attacks(rook_to, after) & opponent.king;
+  }
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+vector<Move> BoardState::generate_legal_moves() const {
+  MoveList moves;
+  generate_legal_moves(moves);
+  return vector<Move>(moves.begin(), moves.end());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void BoardState::generate_legal_moves(MoveList &moves) const {
+  generate_legal_moves(moves, GEN_ALL);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void BoardState::generate_captures(MoveList &moves) const {
+  generate_legal_moves(moves, GEN_CAPTURES);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void BoardState::generate_quiets(MoveList &moves) const {
+  generate_legal_moves(moves, GEN_QUIETS);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void BoardState::generate_evasions(MoveList &moves) const {
+  /* the check restricts the targets by itself */
+  generate_legal_moves(moves, GEN_ALL);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void BoardState::generate_legal_moves(MoveList &moves, int kinds) const {
+  const State &moving = white_to_move ? white : black;
+  const State &opponent = white_to_move ? black : white;
+
+  /* no king, no check : everything is legal */
+  if (!moving.king) {
+    generate_moves(moves, ~((uint64_t)0), kinds);
+    return;
+  }
+
+  const int king = lsb(moving.king);
+  const uint64_t occupied = moving.presence | opponent.presence;
+  const uint64_t checking = checkers();
+
+  /* when in check, the other pieces must capture the checker or block it,
+   * and only the king may move in case of double check */
+  uint64_t targets = ~((uint64_t)0);
+  if (checking) {
+    targets = checking & (checking - 1)
+                  ? 0
+                  : checking | BETWEEN[king][lsb(checking)];
+  }
+
+  const int first = moves.size();
+  generate_moves(moves, targets, kinds);
+
+  /* the king moves are already safe, remains to check the pinned pieces and
+   * the enpassant captures, that remove two pieces from the same rank */
+  const uint64_t pins = pinned();
+  if (!pins && !enpassant) {
+    return;
+  }
+
+  int kept = first;
+  for (int i = first; i < moves.size(); i += 1) {
+    const Move &move = moves[i];
+    const int from = move.from;
+    const int to = move.to;
+    bool legal = true;
+    if (move.enpassant) {
+      const int captured = white_to_move ? to - 8 : to + 8;
+      const uint64_t after = (occupied ^ (((uint64_t)1) << from) ^
+                              (((uint64_t)1) << captured)) |
+                             (((uint64_t)1) << to);
+      legal = !((rook_attacks(king, after) & opponent.orthogonal_sliders()) ||
+                (bishop_attacks(king, after) & opponent.diagonal_sliders()));
+    } else if (move.piece != 'k' && (pins & (((uint64_t)1) << from))) {
+      legal = LINE[king][from] & (((uint64_t)1) << to);
+    }
+    if (legal) {
+      moves[kept++] = move;
+    }
+  }
+  moves.resize(kept);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int BoardState::count_legal_moves() const {
+  return white_to_move ? count_legal_moves<WHITE>()
+                       : count_legal_moves<BLACK>();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <Color Us> int BoardState::count_legal_moves() const {
+  const State &moving = Us == WHITE ? white : black;
+  const State &opponent = Us == WHITE ? black : white;
+  constexpr bool opponent_is_white = Us == BLACK;
+
+  /* no king, no check : everything is legal */
+  if (!moving.king) {
+    MoveList moves;
+    generate_moves<Us>(moves, ~((uint64_t)0), GEN_ALL);
+    return moves.size();
+  }
+
+  const int king = lsb(moving.king);
+  const uint64_t occupied = moving.presence | opponent.presence;
+  const uint64_t checking = checkers();
+  const uint64_t pins = pinned();
+
+  /* same targets as generate_legal_moves() */
+  uint64_t targets = ~((uint64_t)0);
+  if (checking) {
+    targets = checking & (checking - 1)
+                  ? 0
+                  : checking | BETWEEN[king][lsb(checking)];
+  }
+
+  const uint64_t opponent_capturable = opponent.presence & ~opponent.king;
+  const uint64_t king_destinations = ~moving.presence & ~opponent.king;
+  const uint64_t destinations = king_destinations & targets;
+  int count = 0;
+
+  /* pawns, the pinned ones may only move along the pin */
+  count += count_pawn_moves<Us == WHITE>(moving.pawns & ~pins, occupied,
+                                         targets,
+                                         opponent_capturable & targets);
+  for (uint64_t pawns = moving.pawns & pins; pawns;) {
+    const int from = pop_lsb(pawns);
+    const uint64_t line = LINE[king][from];
+    count += count_pawn_moves<Us == WHITE>(
+        BBOARD(from), occupied, targets & line,
+        opponent_capturable & targets & line);
+  }
+
+  /* enpassant captures, tested one by one as they remove two pieces from the
+   * same rank */
+  const uint64_t enpassant_target =
+      enpassant & (targets | (Us == WHITE ? targets << 8 : targets >> 8));
+  if (enpassant_target) {
+    const int to = lsb(enpassant_target);
+    const int captured = Us == WHITE ? to - 8 : to + 8;
+    const uint64_t *captures =
+        Us == WHITE ? BLACK_PAWN_CAPTURES : WHITE_PAWN_CAPTURES;
+    for (uint64_t pawns = moving.pawns & captures[to]; pawns;) {
+      const int from = pop_lsb(pawns);
+      const uint64_t after =
+          (occupied ^ BBOARD(from) ^ BBOARD(captured)) | BBOARD(to);
+      if (!((rook_attacks(king, after) & opponent.orthogonal_sliders()) ||
+            (bishop_attacks(king, after) & opponent.diagonal_sliders()))) {
+        count += 1;
       }
-    } break;
     }
+  }
+
+  /* a pinned knight cannot move */
+  for (uint64_t knights = moving.knights & ~pins; knights;) {
+    count += popcnt64(KNIGHT_CAPTURES[pop_lsb(knights)] & destinations);
+  }
+
+  /* the queens are counted as a bishop plus a rook */
+  for (uint64_t sliders = moving.diagonal_sliders(); sliders;) {
+    const int from = pop_lsb(sliders);
+    const uint64_t allowed =
+        pins & BBOARD(from) ? destinations & LINE[king][from] : destinations;
+    count += popcnt64(bishop_attacks(from, occupied) & allowed);
+  }
+  for (uint64_t sliders = moving.orthogonal_sliders(); sliders;) {
+    const int from = pop_lsb(sliders);
+    const uint64_t allowed =
+        pins & BBOARD(from) ? destinations & LINE[king][from] : destinations;
+    count += popcnt64(rook_attacks(from, occupied) & allowed);
+  }
+
+  /* king, as in generate_moves() */
+  const uint64_t occupied_without_king = occupied & ~moving.king;
+  for (uint64_t b = KING_CAPTURES[king] & king_destinations; b;) {
+    if (!opponent.attackers_to(pop_lsb(b), occupied_without_king,
+                               opponent_is_white)) {
+      count += 1;
+    }
+  }
+
+  /* castlings, as in generate_moves() */
+  count += castling_allowed<Us>(true, occupied, checking);
+  count += castling_allowed<Us>(false, occupied, checking);
+
+  return count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool BoardState::is_pseudo_legal(const Move &move) const {
+  const State &moving = white_to_move ? white : black;
+  const State &opponent = white_to_move ? black : white;
+  const int from = move.from;
+  const int to = move.to;
+  const uint64_t to_bb = BBOARD(to);
+  const uint64_t occupied = moving.presence | opponent.presence;
+
+  if (!move.piece || from > 63 || to > 63 || moving.board[from] != move.piece ||
+      (moving.presence & to_bb)) {
+    return false;
+  }
+
+  /* the captured piece must be the one on the board, the enpassant pawn
+   * aside. The king is never taken */
+  if (move.enpassant) {
+    if (move.piece != 'p' || to_bb != enpassant || move.captured != 'p') {
+      return false;
+    }
+  } else if (move.captured != opponent.board[to] || move.captured == 'k') {
+    return false;
+  }
 
-    p += 1;
+  if (move.kingside_castling || move.queenside_castling) {
+    const int row = white_to_move ? 0 : 7;
+    if (move.piece != 'k' || from != SQUARE(row, 4) ||
+        (move.kingside_castling && move.queenside_castling) ||
+        to != SQUARE(row, move.kingside_castling ? 6 : 2)) {
+      return false;
+    }
+    const bool in_check = opponent.attackers_to(from, occupied, !white_to_move);
+    if (!(white_to_move ? castling_allowed<WHITE>(move.kingside_castling,
+                                                  occupied, in_check)
+                        : castling_allowed<BLACK>(move.kingside_castling,
+                                                  occupied, in_check))) {
+      return false;
+    }
+    return !move.promotion && !move.pawn_jumstart;
+  }
 
-  } while (p->name);
+  if (move.piece != 'p') {
+    if (move.promotion || move.pawn_jumstart) {
+      return false;
+    }
+    switch (move.piece) {
+    case 'n':
+      return KNIGHT_CAPTURES[from] & to_bb;
+    case 'b':
+      return bishop_attacks(from, occupied) & to_bb;
+    case 'r':
+      return rook_attacks(from, occupied) & to_bb;
+    case 'q':
+      return queen_attacks(from, occupied) & to_bb;
+    case 'k':
+      /* generate_moves() only yields the safe king steps */
+      return (KING_CAPTURES[from] & to_bb) &&
+             !opponent.attackers_to(to, occupied ^ BBOARD(from),
+                                    !white_to_move);
+    }
+    return false;
+  }
 
-  return moves;
+  /* pawns : a move to the last rank is a promotion */
+  const int forward = white_to_move ? 8 : -8;
+  const uint64_t last_rank = white_to_move ? RANK_8 : RANK_1;
+  if ((to_bb & last_rank) ? !move.promotion || move.promotion == 'p' ||
+                                move.promotion == 'k'
+                          : move.promotion != '\0') {
+    return false;
+  }
+  if (move.pawn_jumstart) {
+    return to == from + 2 * forward && ROW(from) == (white_to_move ? 1 : 6) &&
+           !(occupied & (BBOARD(from + forward) | to_bb));
+  }
+  if (COL(from) == COL(to)) {
+    return to == from + forward && !move.captured;
+  }
+  return move.captured &&
+         ((white_to_move ? WHITE_PAWN_CAPTURES : BLACK_PAWN_CAPTURES)[from] &
+          to_bb);
 }
 
+////////////////////////////////////////////////////////////////////////////////
 bool BoardState::is_legal(const Move &move) const {
-  BoardState b(*this);
-  return b.make_move(move);
+  const State &moving = white_to_move ? white : black;
+  const State &opponent = white_to_move ? black : white;
+
+  /* the castlings are checked by is_pseudo_legal() */
+  if (!moving.king || move.kingside_castling || move.queenside_castling) {
+    return true;
+  }
+
+  /* the king must not be attacked once the move is played, but by the piece
+   * that is captured */
+  const int king = move.piece == 'k' ? move.to : lsb(moving.king);
+  uint64_t captured = BBOARD(move.to);
+  if (move.enpassant) {
+    captured = BBOARD(white_to_move ? move.to - 8 : move.to + 8);
+  }
+  const uint64_t occupied =
+      (((moving.presence | opponent.presence) ^ BBOARD(move.from)) &
+       ~captured) |
+      BBOARD(move.to);
+  return !(opponent.attackers_to(king, occupied, !white_to_move) & ~captured);
 }
 
 } // namespace siegbert
@@ -2,16 +2,19 @@
 #ifndef BoardState_HPP
 #define BoardState_HPP
 
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 typedef uint8_t square_t;
 
-#define SQUARE(R, C) ((square_t)(16 * (R) + (C)))
-#define ROW(S) (((square_t)(S)) >> 4)
+/* squares are numbered from 0 (a1) to 63 (h8), which is also the offset of
+ * their bit in the bitboards */
+#define SQUARE(R, C) ((square_t)(8 * (R) + (C)))
+#define ROW(S) (((square_t)(S)) >> 3)
 #define COL(S) (((square_t)(S)) & 7)
-#define OFFSET(S) ((S + (S & 7)) >> 1)
-#define BBOARD(S) (((uint64_t)1) << OFFSET(S))
+#define BBOARD(S) (((uint64_t)1) << (S))
 #define NAME(S)                                                                \
   (std::string({(char)('a' + COL(S))}) + std::to_string(1 + ROW(S)))
 namespace siegbert {
@@ -39,17 +42,116 @@ public:
 
   bool pawn_jumstart;
 
-  int weight;
+  /* move ordering hint, 16 bits are enough and keep the struct small */
+  int16_t weight;
 
   std::string to_str() const;
 
   std::string to_json() const;
 
   uint16_t to_polyglot(bool white) const;
+
+  /** 16 bits form (from, to, promotion), see PackedMove */
+  uint16_t to_short() const;
+};
+
+/*
+32 bits encoding of a Move (bit 0 is the least significant bit)
+
+bits                meaning
+===================================
+0..5                from (bitboard offset)
+6..11               to (bitboard offset)
+12..14              promotion piece (none, n, b, r, q)
+15..17              piece (p, n, b, r, q, k)
+18..20              captured piece (none, p, n, b, r, q)
+21                  enpassant
+22                  kingside castling
+23                  queenside castling
+24                  pawn jumpstart
+
+The lower 16 bits are enough to identify a move in a given position, this is
+the form stored in the transposition table.
+*/
+struct PackedMove {
+public:
+  uint32_t data;
+
+  PackedMove() : data(0) {}
+
+  explicit PackedMove(uint32_t data_) : data(data_) {}
+
+  PackedMove(const Move &move);
+
+  Move unpack() const;
+
+  inline uint16_t to_short() const { return data & 0xffff; }
+
+  inline int from_offset() const { return data & 0x3f; }
+
+  inline int to_offset() const { return (data >> 6) & 0x3f; }
+
+  inline bool is_capture() const { return (data >> 18) & 0x7; }
+
+  inline bool operator==(const PackedMove &other) const {
+    return data == other.data;
+  }
+
+  std::string to_str() const;
+
+  uint16_t to_polyglot(bool white) const;
 };
 
 std::ostream &operator<<(std::ostream &os, const Move &move);
 
+/** fixed-capacity list of moves, meant to live on the stack */
+struct MoveList {
+public:
+  /* no legal chess position has more than 218 moves */
+  static const int MAX_MOVES = 256;
+
+private:
+  /* left uninitialized on purpose : only [0, count) is ever read */
+  union {
+    Move items[MAX_MOVES];
+  };
+
+  int count;
+
+public:
+  MoveList() : count(0) {}
+
+  inline void push_back(const Move &move) { items[count++] = move; }
+
+  inline void clear() { count = 0; }
+
+  /** keeps the first n moves */
+  inline void resize(int n) { count = n; }
+
+  inline int size() const { return count; }
+
+  inline bool empty() const { return count == 0; }
+
+  inline Move &operator[](int i) { return items[i]; }
+
+  inline const Move &operator[](int i) const { return items[i]; }
+
+  inline Move *begin() { return items; }
+
+  inline Move *end() { return items + count; }
+
+  inline const Move *begin() const { return items; }
+
+  inline const Move *end() const { return items + count; }
+};
+
+/** kinds of moves to generate, can be or'ed together */
+enum MoveKinds { GEN_CAPTURES = 1, GEN_QUIETS = 2, GEN_ALL = 3 };
+
+/** a side, as a template parameter : the colour dependent constants of the
+ * specialized functions fold at compile time */
+enum Color { WHITE, BLACK };
+
 struct Castling {
 public:
   Castling();
@@ -59,11 +161,52 @@ public:
 
 struct Memento {
   uint64_t z;
+  uint64_t pawn_key;
+  uint64_t material_key;
   uint64_t enpassant;
   int halfmoves;
-  Castling castling;
+  int plies_from_null;
+  Castling white_castling;
+  Castling black_castling;
+};
+
+/** what BoardState::gives_check() needs to know about the opponent king,
+ * computed once per position */
+struct CheckInfo {
+  /* square of the opponent king, -1 if there is none */
+  int king;
+
+  /* pieces of the side to move that uncover a check when they leave the
+   * line between one of their sliders and the king */
+  uint64_t discoverers;
+
+  /* squares from which each kind of piece would give check (the queens
+   * from both bishop_checks and rook_checks) */
+  uint64_t pawn_checks;
+  uint64_t knight_checks;
+  uint64_t bishop_checks;
+  uint64_t rook_checks;
 };
 
+/** the classical value of a piece, in centipawns : this weighs the captures,
+ * in the static exchange evaluation and in the moves ordering */
+inline int material_value(char piece) {
+  switch (piece) {
+  case 'p':
+    return 100;
+  case 'n':
+  case 'b':
+    return 300;
+  case 'r':
+    return 500;
+  case 'q':
+    return 1000;
+  case 'k':
+    return 10000;
+  }
+  return 0;
+}
+
 struct PiecesCount {
   int white_knights;
   int white_bishops;
@@ -77,12 +220,6 @@ struct PiecesCount {
   int black_pawns;
 };
 
-struct Piece {
-  Piece();
-  char name;
-  square_t square;
-};
-
 struct StateUpdateResult {
   Castling castling_rights;
   uint64_t enpassant;
@@ -90,24 +227,48 @@ struct StateUpdateResult {
 };
 
 class State {
-private:
-  char remove_from_piece_list(square_t square);
-
 public:
-  State();
+  explicit State(bool white);
   uint64_t presence;
   uint64_t pawns;
-  uint64_t rooks;
   uint64_t knights;
   uint64_t bishops;
+  uint64_t rooks;
+  uint64_t queens;
   uint64_t king;
-  Piece pieces[17];
-  int npieces;
+
+  /* mailbox, indexed by bitboard offset : the piece standing on each square,
+   * '\0' when empty */
+  char board[64];
+
+  /* xor'ed to the squares to read the piece-square tables (56 for white) */
+  square_t psq_flip;
+
+  /* sums of the midgame and endgame values of the pieces (see
+   * PieceSquareTables.hpp), and of their phase weights. They are updated
+   * along with the bitboards */
+  int mg;
+  int eg;
+  int phase;
+
+  /** the bitboard of the given kind of piece, one of "pnbrqk" */
+  uint64_t &bitboard(char piece);
+  const uint64_t &bitboard(char piece) const;
+
+  /** pieces that slide along the ranks and files, or along the diagonals */
+  uint64_t orthogonal_sliders() const { return rooks | queens; }
+  uint64_t diagonal_sliders() const { return bishops | queens; }
 
   void enplace(char piece, square_t square);
 
   uint64_t compute_attack(const State &opponent, bool im_white) const;
 
+  /** pieces of this side that attack the given square (bitboard offset) */
+  uint64_t attackers_to(int offset, uint64_t occupied, bool im_white) const;
+
+  /** true if the king of this side is attacked by the opponent */
+  bool king_attacked(const State &opponent, bool im_white) const;
+
   void move_piece(char piece, square_t from, square_t to);
 
   void remove_piece(square_t square);
@@ -116,23 +277,102 @@ public:
 
   char piece_at(square_t square) const;
 
-  void update_for_capture(const Move &move, bool white);
+  /** adds (sign = 1) or removes (sign = -1) the values of a piece */
+  void update_psq(char piece, square_t square, int sign);
+
+  /** removes the piece captured by the move, Us being the colour of this
+   * side */
+  template <Color Us> void update_for_capture(const Move &move);
 
-  void update_for_move(const Move &move, bool white, StateUpdateResult &result);
+  template <Color Us>
+  void update_for_move(const Move &move, StateUpdateResult &result);
+};
+
+/** thrown when parsing a fen or an epd, position being the offset of the
+ * unexpected character */
+class FenError : public std::invalid_argument {
+public:
+  FenError(const std::string &what, size_t position);
+
+  const size_t position;
 };
 
 struct BoardState {
 
 private:
+  static constexpr int HISTORY_SIZE = 256;
+
+  /* zobrist hashes of the positions before each move, indexed by ply modulo
+   * HISTORY_SIZE : only the positions since the last capture or pawn move can
+   * repeat, and there are less than HISTORY_SIZE of them in practice */
+  uint64_t history[HISTORY_SIZE];
+
+  /* number of moves played since the position was set up */
+  int plies;
+
+  /* number of moves played since the last null move : the positions before
+   * a null move do not count as repetitions */
+  int plies_from_null;
+
   BoardState();
 
-  void evolve_z(const Move &move, const Castling &previous_castling,
+  void push_history();
+
+  /* the specialized versions of the public functions, Us being the side to
+   * move (or the side that has played the move, for unmake_move and
+   * evolve_z) */
+
+  template <Color Us>
+  void evolve_z(const Move &move, const Castling &previous_white_castling,
+                const Castling &previous_black_castling,
                 int previous_halfmoves, uint64_t previous_enpassant);
 
+  template <Color Us> void make_legal_move(const Move &move);
+
+  /** the enpassant square, if it is part of the zobrist hash : only when Us
+   * can actually take enpassant */
+  template <Color Us> uint64_t hashed_enpassant() const;
+
+  void evolve_z_null_move(uint64_t previous_enpassant);
+
+  template <Color Us>
+  void unmake_move(const Move &move, const Memento &memento);
+
+  template <Color Us>
+  void generate_moves(MoveList &moves, uint64_t targets, int kinds) const;
+
+  template <Color Us> int count_legal_moves() const;
+
+  /** the castling of Us on this side is allowed : the right is kept, the king
+   * is not in check, the squares between the king and the rook are empty and
+   * the king does not cross nor reach an attacked square */
+  template <Color Us>
+  bool castling_allowed(bool kingside, uint64_t occupied, bool in_check) const;
+
   void recompute_z();
 
+  /** the four fields shared by the fen and the epd, returns the end */
+  char *write_position(char *out) const;
+
+  /** the pieces left on the board once the move has left its square */
+  uint64_t see_occupancy(const Move &move) const;
+
+  /** pseudo-legal moves of the given kinds (see MoveKinds), the pieces other
+   * than the king may only move to (or capture on) the targets */
+  void generate_moves(MoveList &moves, uint64_t targets, int kinds) const;
+
+  void generate_legal_moves(MoveList &moves, int kinds) const;
+
 public:
   uint64_t z; /* zobrist hash */
+
+  /* xor of the zobrist keys of the pawns and the kings only, for the pawn
+   * structure caches */
+  uint64_t pawn_key;
+
+  /* depends only on the number of pieces of each kind (see count_pieces()),
+   * for the material tables */
+  uint64_t material_key;
   uint64_t enpassant;
   Castling white_castling;
   Castling black_castling;
@@ -144,29 +384,128 @@ public:
 
   static BoardState initial();
 
-  static BoardState from_fen(const std::string &fen);
+  /* enough room for any fen : 64 squares, 7 '/', the 4 short fields and two
+   * numbers of 10 digits at most */
+  static constexpr int MAX_FEN_LENGTH = 128;
+
+  /** throws a FenError on invalid input. The parsing does no allocation, so
+   * that millions of positions can be loaded quickly */
+  static BoardState from_fen(std::string_view fen);
+
+  /** the first four fields of a fen, followed by the operations (such as
+   * "bm Nf3; id \"test 1\";") which are returned without being parsed.
+   * The operations point into epd */
+  static BoardState from_epd(std::string_view epd,
+                             std::string_view *operations = nullptr);
 
   std::string to_fen() const;
 
+  /** writes the fen into a buffer of MAX_FEN_LENGTH chars at least, without
+   * a terminating '\0'. Returns the length of the fen */
+  int write_fen(char *buffer) const;
+
+  /** same as write_fen(), without the move counters */
+  int write_epd(char *buffer) const;
+
   std::string to_str() const;
 
   char piece_at(square_t square) const;
 
   std::vector<Move> generate_moves() const;
 
-  Move get_move(const std::string &san) const;
+  /** same as generate_moves(), without any heap allocation */
+  void generate_moves(MoveList &moves) const;
+
+  /** only the legal moves : no need to check the result of make_move() */
+  std::vector<Move> generate_legal_moves() const;
+
+  void generate_legal_moves(MoveList &moves) const;
+
+  /** the number of legal moves, counted without generating them (the bulk
+   * counting of perft) */
+  int count_legal_moves() const;
+
+  /** legal captures, enpassant captures and promotions */
+  void generate_captures(MoveList &moves) const;
+
+  /** legal moves that are not generated by generate_captures() */
+  void generate_quiets(MoveList &moves) const;
+
+  /** all the legal moves, to be used when in check : only the moves that
+   * capture or block the checker are generated */
+  void generate_evasions(MoveList &moves) const;
+
+  /** opponent pieces giving check to the side to move */
+  uint64_t checkers() const;
+
+  /** pieces of the side to move that cannot leave the line between their king
+   * and an enemy slider */
+  uint64_t pinned() const;
+
+  /** the legal move written in standard algebraic notation ("Nbd7",
+   * "exd5", "e8=Q+", "O-O") or in coordinate notation ("e2e4", "e7e8q").
+   * Throws invalid_argument if there is no such move */
+  Move get_move(std::string_view san) const;
+
+  CheckInfo check_info() const;
+
+  /** true if the (legal) move gives check, without playing it. The info
+   * comes from check_info(), to share it between the moves of a position */
+  bool gives_check(const Move &move, const CheckInfo &info) const;
+
+  bool gives_check(const Move &move) const;
+
+  /** rebuilds a move from its 16 bits form, using the pieces on the board.
+   * The move is not checked for legality (see is_pseudo_legal()), piece is
+   * '\0' if the from square is not occupied by the side to move, or if the
+   * code is not a valid one */
+  Move move_from_short(uint16_t code) const;
 
   bool make_move(const Move &move);
 
-  /** this is quite costly, you should instead check the result of make_move()
-   * when possible
-   */
+  /** plays a move known to be legal (see generate_legal_moves()), skipping
+   * the king safety test of make_move() */
+  void make_legal_move(const Move &move);
+
+  /** static exchange evaluation : the material won by the move (in
+   * centipawns) once the pieces attacking its destination, including the
+   * sliders revealed behind them, have traded as long as it pays off. The
+   * pins are ignored */
+  int see(const Move &move) const;
+
+  /** see(move) >= threshold, but faster : the exchange stops as soon as its
+   * outcome is known */
+  bool see_ge(const Move &move, int threshold = 0) const;
+
+  /** true if the move could have been generated by generate_moves() : the
+   * move may come from another position (a hash move, a killer move, see
+   * move_from_short()), and it is checked against this one */
+  bool is_pseudo_legal(const Move &move) const;
+
+  /** true if a pseudo-legal move does not leave the king in check. This
+   * does not play the move */
   bool is_legal(const Move &move) const;
 
   Memento memento() const;
 
   void unmake_move(const Move &move, const Memento &memento);
 
+  /** passes the turn without moving, for the null move pruning. The side to
+   * move must not be in check */
+  void make_null_move();
+
+  /** takes back make_null_move(), the memento being taken before it */
+  void unmake_null_move(const Memento &memento);
+
+  /** true if the position already occurred count times since the last
+   * capture or pawn move. Only the positions with the same side to move are
+   * compared. A single occurrence less than ply plies ago is enough : at ply
+   * plies from the root of a search, it repeats a position of the tree */
+  bool is_repetition(int count = 1, int ply = 0) const;
+
+  /** fifty moves (100 plies) without capture nor pawn move */
+  bool is_fifty_moves() const;
+
   bool is_check() const;
 
   std::string attacked_str() const;
@@ -181,12 +520,20 @@ public:
 
   PiecesCount count_pieces() const;
 
+  /** the midgame and endgame values of the piece-square tables, blended
+   * according to the phase : in centipawns, positive when white is better.
+   * This is kept up to date by make_move() and unmake_move() */
+  int psq_score() const;
+
   uint64_t get_zobrist_hash() const;
+
+  uint64_t get_pawn_key() const;
+
+  uint64_t get_material_key() const;
 };
 
 std::ostream &operator<<(std::ostream &os, const BoardState &boardstate);
 
-uint8_t square_for_bboard(uint64_t l);
 
 } // namespace siegbert
 #endif
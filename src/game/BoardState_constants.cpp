@@ -68,583 +68,6 @@ const uint64_t KING_CAPTURES[64] = {
     /*g8*/ 0xa0e0000000000000UL,
     /*h8*/ 0x40c0000000000000UL,
 };
-const bboard_and_square_t KING_MOVES[64][8] = {
-    /*a1*/ {{0x2UL, 0x1},
-            {0x100UL, 0x10},
-            {0x200UL, 0x11},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88}},
-    /*b1*/
-    {{0x1UL, 0x0},
-     {0x4UL, 0x2},
-     {0x100UL, 0x10},
-     {0x200UL, 0x11},
-     {0x400UL, 0x12},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c1*/
-    {{0x2UL, 0x1},
-     {0x8UL, 0x3},
-     {0x200UL, 0x11},
-     {0x400UL, 0x12},
-     {0x800UL, 0x13},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d1*/
-    {{0x4UL, 0x2},
-     {0x10UL, 0x4},
-     {0x400UL, 0x12},
-     {0x800UL, 0x13},
-     {0x1000UL, 0x14},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e1*/
-    {{0x8UL, 0x3},
-     {0x20UL, 0x5},
-     {0x800UL, 0x13},
-     {0x1000UL, 0x14},
-     {0x2000UL, 0x15},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f1*/
-    {{0x10UL, 0x4},
-     {0x40UL, 0x6},
-     {0x1000UL, 0x14},
-     {0x2000UL, 0x15},
-     {0x4000UL, 0x16},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g1*/
-    {{0x20UL, 0x5},
-     {0x80UL, 0x7},
-     {0x2000UL, 0x15},
-     {0x4000UL, 0x16},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h1*/
-    {{0x40UL, 0x6},
-     {0x4000UL, 0x16},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a2*/
-    {{0x1UL, 0x0},
-     {0x2UL, 0x1},
-     {0x200UL, 0x11},
-     {0x10000UL, 0x20},
-     {0x20000UL, 0x21},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b2*/
-    {{0x1UL, 0x0},
-     {0x2UL, 0x1},
-     {0x4UL, 0x2},
-     {0x100UL, 0x10},
-     {0x400UL, 0x12},
-     {0x10000UL, 0x20},
-     {0x20000UL, 0x21},
-     {0x40000UL, 0x22}},
-    /*c2*/
-    {{0x2UL, 0x1},
-     {0x4UL, 0x2},
-     {0x8UL, 0x3},
-     {0x200UL, 0x11},
-     {0x800UL, 0x13},
-     {0x20000UL, 0x21},
-     {0x40000UL, 0x22},
-     {0x80000UL, 0x23}},
-    /*d2*/
-    {{0x4UL, 0x2},
-     {0x8UL, 0x3},
-     {0x10UL, 0x4},
-     {0x400UL, 0x12},
-     {0x1000UL, 0x14},
-     {0x40000UL, 0x22},
-     {0x80000UL, 0x23},
-     {0x100000UL, 0x24}},
-    /*e2*/
-    {{0x8UL, 0x3},
-     {0x10UL, 0x4},
-     {0x20UL, 0x5},
-     {0x800UL, 0x13},
-     {0x2000UL, 0x15},
-     {0x80000UL, 0x23},
-     {0x100000UL, 0x24},
-     {0x200000UL, 0x25}},
-    /*f2*/
-    {{0x10UL, 0x4},
-     {0x20UL, 0x5},
-     {0x40UL, 0x6},
-     {0x1000UL, 0x14},
-     {0x4000UL, 0x16},
-     {0x100000UL, 0x24},
-     {0x200000UL, 0x25},
-     {0x400000UL, 0x26}},
-    /*g2*/
-    {{0x20UL, 0x5},
-     {0x40UL, 0x6},
-     {0x80UL, 0x7},
-     {0x2000UL, 0x15},
-     {0x8000UL, 0x17},
-     {0x200000UL, 0x25},
-     {0x400000UL, 0x26},
-     {0x800000UL, 0x27}},
-    /*h2*/
-    {{0x40UL, 0x6},
-     {0x80UL, 0x7},
-     {0x4000UL, 0x16},
-     {0x400000UL, 0x26},
-     {0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a3*/
-    {{0x100UL, 0x10},
-     {0x200UL, 0x11},
-     {0x20000UL, 0x21},
-     {0x1000000UL, 0x30},
-     {0x2000000UL, 0x31},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b3*/
-    {{0x100UL, 0x10},
-     {0x200UL, 0x11},
-     {0x400UL, 0x12},
-     {0x10000UL, 0x20},
-     {0x40000UL, 0x22},
-     {0x1000000UL, 0x30},
-     {0x2000000UL, 0x31},
-     {0x4000000UL, 0x32}},
-    /*c3*/
-    {{0x200UL, 0x11},
-     {0x400UL, 0x12},
-     {0x800UL, 0x13},
-     {0x20000UL, 0x21},
-     {0x80000UL, 0x23},
-     {0x2000000UL, 0x31},
-     {0x4000000UL, 0x32},
-     {0x8000000UL, 0x33}},
-    /*d3*/
-    {{0x400UL, 0x12},
-     {0x800UL, 0x13},
-     {0x1000UL, 0x14},
-     {0x40000UL, 0x22},
-     {0x100000UL, 0x24},
-     {0x4000000UL, 0x32},
-     {0x8000000UL, 0x33},
-     {0x10000000UL, 0x34}},
-    /*e3*/
-    {{0x800UL, 0x13},
-     {0x1000UL, 0x14},
-     {0x2000UL, 0x15},
-     {0x80000UL, 0x23},
-     {0x200000UL, 0x25},
-     {0x8000000UL, 0x33},
-     {0x10000000UL, 0x34},
-     {0x20000000UL, 0x35}},
-    /*f3*/
-    {{0x1000UL, 0x14},
-     {0x2000UL, 0x15},
-     {0x4000UL, 0x16},
-     {0x100000UL, 0x24},
-     {0x400000UL, 0x26},
-     {0x10000000UL, 0x34},
-     {0x20000000UL, 0x35},
-     {0x40000000UL, 0x36}},
-    /*g3*/
-    {{0x2000UL, 0x15},
-     {0x4000UL, 0x16},
-     {0x8000UL, 0x17},
-     {0x200000UL, 0x25},
-     {0x800000UL, 0x27},
-     {0x20000000UL, 0x35},
-     {0x40000000UL, 0x36},
-     {0x80000000UL, 0x37}},
-    /*h3*/
-    {{0x4000UL, 0x16},
-     {0x8000UL, 0x17},
-     {0x400000UL, 0x26},
-     {0x40000000UL, 0x36},
-     {0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a4*/
-    {{0x10000UL, 0x20},
-     {0x20000UL, 0x21},
-     {0x2000000UL, 0x31},
-     {0x100000000UL, 0x40},
-     {0x200000000UL, 0x41},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b4*/
-    {{0x10000UL, 0x20},
-     {0x20000UL, 0x21},
-     {0x40000UL, 0x22},
-     {0x1000000UL, 0x30},
-     {0x4000000UL, 0x32},
-     {0x100000000UL, 0x40},
-     {0x200000000UL, 0x41},
-     {0x400000000UL, 0x42}},
-    /*c4*/
-    {{0x20000UL, 0x21},
-     {0x40000UL, 0x22},
-     {0x80000UL, 0x23},
-     {0x2000000UL, 0x31},
-     {0x8000000UL, 0x33},
-     {0x200000000UL, 0x41},
-     {0x400000000UL, 0x42},
-     {0x800000000UL, 0x43}},
-    /*d4*/
-    {{0x40000UL, 0x22},
-     {0x80000UL, 0x23},
-     {0x100000UL, 0x24},
-     {0x4000000UL, 0x32},
-     {0x10000000UL, 0x34},
-     {0x400000000UL, 0x42},
-     {0x800000000UL, 0x43},
-     {0x1000000000UL, 0x44}},
-    /*e4*/
-    {{0x80000UL, 0x23},
-     {0x100000UL, 0x24},
-     {0x200000UL, 0x25},
-     {0x8000000UL, 0x33},
-     {0x20000000UL, 0x35},
-     {0x800000000UL, 0x43},
-     {0x1000000000UL, 0x44},
-     {0x2000000000UL, 0x45}},
-    /*f4*/
-    {{0x100000UL, 0x24},
-     {0x200000UL, 0x25},
-     {0x400000UL, 0x26},
-     {0x10000000UL, 0x34},
-     {0x40000000UL, 0x36},
-     {0x1000000000UL, 0x44},
-     {0x2000000000UL, 0x45},
-     {0x4000000000UL, 0x46}},
-    /*g4*/
-    {{0x200000UL, 0x25},
-     {0x400000UL, 0x26},
-     {0x800000UL, 0x27},
-     {0x20000000UL, 0x35},
-     {0x80000000UL, 0x37},
-     {0x2000000000UL, 0x45},
-     {0x4000000000UL, 0x46},
-     {0x8000000000UL, 0x47}},
-    /*h4*/
-    {{0x400000UL, 0x26},
-     {0x800000UL, 0x27},
-     {0x40000000UL, 0x36},
-     {0x4000000000UL, 0x46},
-     {0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a5*/
-    {{0x1000000UL, 0x30},
-     {0x2000000UL, 0x31},
-     {0x200000000UL, 0x41},
-     {0x10000000000UL, 0x50},
-     {0x20000000000UL, 0x51},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b5*/
-    {{0x1000000UL, 0x30},
-     {0x2000000UL, 0x31},
-     {0x4000000UL, 0x32},
-     {0x100000000UL, 0x40},
-     {0x400000000UL, 0x42},
-     {0x10000000000UL, 0x50},
-     {0x20000000000UL, 0x51},
-     {0x40000000000UL, 0x52}},
-    /*c5*/
-    {{0x2000000UL, 0x31},
-     {0x4000000UL, 0x32},
-     {0x8000000UL, 0x33},
-     {0x200000000UL, 0x41},
-     {0x800000000UL, 0x43},
-     {0x20000000000UL, 0x51},
-     {0x40000000000UL, 0x52},
-     {0x80000000000UL, 0x53}},
-    /*d5*/
-    {{0x4000000UL, 0x32},
-     {0x8000000UL, 0x33},
-     {0x10000000UL, 0x34},
-     {0x400000000UL, 0x42},
-     {0x1000000000UL, 0x44},
-     {0x40000000000UL, 0x52},
-     {0x80000000000UL, 0x53},
-     {0x100000000000UL, 0x54}},
-    /*e5*/
-    {{0x8000000UL, 0x33},
-     {0x10000000UL, 0x34},
-     {0x20000000UL, 0x35},
-     {0x800000000UL, 0x43},
-     {0x2000000000UL, 0x45},
-     {0x80000000000UL, 0x53},
-     {0x100000000000UL, 0x54},
-     {0x200000000000UL, 0x55}},
-    /*f5*/
-    {{0x10000000UL, 0x34},
-     {0x20000000UL, 0x35},
-     {0x40000000UL, 0x36},
-     {0x1000000000UL, 0x44},
-     {0x4000000000UL, 0x46},
-     {0x100000000000UL, 0x54},
-     {0x200000000000UL, 0x55},
-     {0x400000000000UL, 0x56}},
-    /*g5*/
-    {{0x20000000UL, 0x35},
-     {0x40000000UL, 0x36},
-     {0x80000000UL, 0x37},
-     {0x2000000000UL, 0x45},
-     {0x8000000000UL, 0x47},
-     {0x200000000000UL, 0x55},
-     {0x400000000000UL, 0x56},
-     {0x800000000000UL, 0x57}},
-    /*h5*/
-    {{0x40000000UL, 0x36},
-     {0x80000000UL, 0x37},
-     {0x4000000000UL, 0x46},
-     {0x400000000000UL, 0x56},
-     {0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a6*/
-    {{0x100000000UL, 0x40},
-     {0x200000000UL, 0x41},
-     {0x20000000000UL, 0x51},
-     {0x1000000000000UL, 0x60},
-     {0x2000000000000UL, 0x61},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b6*/
-    {{0x100000000UL, 0x40},
-     {0x200000000UL, 0x41},
-     {0x400000000UL, 0x42},
-     {0x10000000000UL, 0x50},
-     {0x40000000000UL, 0x52},
-     {0x1000000000000UL, 0x60},
-     {0x2000000000000UL, 0x61},
-     {0x4000000000000UL, 0x62}},
-    /*c6*/
-    {{0x200000000UL, 0x41},
-     {0x400000000UL, 0x42},
-     {0x800000000UL, 0x43},
-     {0x20000000000UL, 0x51},
-     {0x80000000000UL, 0x53},
-     {0x2000000000000UL, 0x61},
-     {0x4000000000000UL, 0x62},
-     {0x8000000000000UL, 0x63}},
-    /*d6*/
-    {{0x400000000UL, 0x42},
-     {0x800000000UL, 0x43},
-     {0x1000000000UL, 0x44},
-     {0x40000000000UL, 0x52},
-     {0x100000000000UL, 0x54},
-     {0x4000000000000UL, 0x62},
-     {0x8000000000000UL, 0x63},
-     {0x10000000000000UL, 0x64}},
-    /*e6*/
-    {{0x800000000UL, 0x43},
-     {0x1000000000UL, 0x44},
-     {0x2000000000UL, 0x45},
-     {0x80000000000UL, 0x53},
-     {0x200000000000UL, 0x55},
-     {0x8000000000000UL, 0x63},
-     {0x10000000000000UL, 0x64},
-     {0x20000000000000UL, 0x65}},
-    /*f6*/
-    {{0x1000000000UL, 0x44},
-     {0x2000000000UL, 0x45},
-     {0x4000000000UL, 0x46},
-     {0x100000000000UL, 0x54},
-     {0x400000000000UL, 0x56},
-     {0x10000000000000UL, 0x64},
-     {0x20000000000000UL, 0x65},
-     {0x40000000000000UL, 0x66}},
-    /*g6*/
-    {{0x2000000000UL, 0x45},
-     {0x4000000000UL, 0x46},
-     {0x8000000000UL, 0x47},
-     {0x200000000000UL, 0x55},
-     {0x800000000000UL, 0x57},
-     {0x20000000000000UL, 0x65},
-     {0x40000000000000UL, 0x66},
-     {0x80000000000000UL, 0x67}},
-    /*h6*/
-    {{0x4000000000UL, 0x46},
-     {0x8000000000UL, 0x47},
-     {0x400000000000UL, 0x56},
-     {0x40000000000000UL, 0x66},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a7*/
-    {{0x10000000000UL, 0x50},
-     {0x20000000000UL, 0x51},
-     {0x2000000000000UL, 0x61},
-     {0x100000000000000UL, 0x70},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b7*/
-    {{0x10000000000UL, 0x50},
-     {0x20000000000UL, 0x51},
-     {0x40000000000UL, 0x52},
-     {0x1000000000000UL, 0x60},
-     {0x4000000000000UL, 0x62},
-     {0x100000000000000UL, 0x70},
-     {0x200000000000000UL, 0x71},
-     {0x400000000000000UL, 0x72}},
-    /*c7*/
-    {{0x20000000000UL, 0x51},
-     {0x40000000000UL, 0x52},
-     {0x80000000000UL, 0x53},
-     {0x2000000000000UL, 0x61},
-     {0x8000000000000UL, 0x63},
-     {0x200000000000000UL, 0x71},
-     {0x400000000000000UL, 0x72},
-     {0x800000000000000UL, 0x73}},
-    /*d7*/
-    {{0x40000000000UL, 0x52},
-     {0x80000000000UL, 0x53},
-     {0x100000000000UL, 0x54},
-     {0x4000000000000UL, 0x62},
-     {0x10000000000000UL, 0x64},
-     {0x400000000000000UL, 0x72},
-     {0x800000000000000UL, 0x73},
-     {0x1000000000000000UL, 0x74}},
-    /*e7*/
-    {{0x80000000000UL, 0x53},
-     {0x100000000000UL, 0x54},
-     {0x200000000000UL, 0x55},
-     {0x8000000000000UL, 0x63},
-     {0x20000000000000UL, 0x65},
-     {0x800000000000000UL, 0x73},
-     {0x1000000000000000UL, 0x74},
-     {0x2000000000000000UL, 0x75}},
-    /*f7*/
-    {{0x100000000000UL, 0x54},
-     {0x200000000000UL, 0x55},
-     {0x400000000000UL, 0x56},
-     {0x10000000000000UL, 0x64},
-     {0x40000000000000UL, 0x66},
-     {0x1000000000000000UL, 0x74},
-     {0x2000000000000000UL, 0x75},
-     {0x4000000000000000UL, 0x76}},
-    /*g7*/
-    {{0x200000000000UL, 0x55},
-     {0x400000000000UL, 0x56},
-     {0x800000000000UL, 0x57},
-     {0x20000000000000UL, 0x65},
-     {0x80000000000000UL, 0x67},
-     {0x2000000000000000UL, 0x75},
-     {0x4000000000000000UL, 0x76},
-     {0x8000000000000000UL, 0x77}},
-    /*h7*/
-    {{0x400000000000UL, 0x56},
-     {0x800000000000UL, 0x57},
-     {0x40000000000000UL, 0x66},
-     {0x4000000000000000UL, 0x76},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a8*/
-    {{0x1000000000000UL, 0x60},
-     {0x2000000000000UL, 0x61},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b8*/
-    {{0x1000000000000UL, 0x60},
-     {0x2000000000000UL, 0x61},
-     {0x4000000000000UL, 0x62},
-     {0x100000000000000UL, 0x70},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c8*/
-    {{0x2000000000000UL, 0x61},
-     {0x4000000000000UL, 0x62},
-     {0x8000000000000UL, 0x63},
-     {0x200000000000000UL, 0x71},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d8*/
-    {{0x4000000000000UL, 0x62},
-     {0x8000000000000UL, 0x63},
-     {0x10000000000000UL, 0x64},
-     {0x400000000000000UL, 0x72},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e8*/
-    {{0x8000000000000UL, 0x63},
-     {0x10000000000000UL, 0x64},
-     {0x20000000000000UL, 0x65},
-     {0x800000000000000UL, 0x73},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f8*/
-    {{0x10000000000000UL, 0x64},
-     {0x20000000000000UL, 0x65},
-     {0x40000000000000UL, 0x66},
-     {0x1000000000000000UL, 0x74},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g8*/
-    {{0x20000000000000UL, 0x65},
-     {0x40000000000000UL, 0x66},
-     {0x80000000000000UL, 0x67},
-     {0x2000000000000000UL, 0x75},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h8*/
-    {{0x40000000000000UL, 0x66},
-     {0x80000000000000UL, 0x67},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-};
 const uint64_t KNIGHT_CAPTURES[64] = {
     /*a1*/ 0x20400UL,
     /*b1*/ 0x50800UL,
@@ -711,583 +134,6 @@ const uint64_t KNIGHT_CAPTURES[64] = {
     /*g8*/ 0x10a00000000000UL,
     /*h8*/ 0x20400000000000UL,
 };
-const bboard_and_square_t KNIGHT_MOVES[64][8] = {
-    /*a1*/ {{0x400UL, 0x12},
-            {0x20000UL, 0x21},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88}},
-    /*b1*/
-    {{0x800UL, 0x13},
-     {0x40000UL, 0x22},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c1*/
-    {{0x1000UL, 0x14},
-     {0x100UL, 0x10},
-     {0x80000UL, 0x23},
-     {0x20000UL, 0x21},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d1*/
-    {{0x2000UL, 0x15},
-     {0x200UL, 0x11},
-     {0x100000UL, 0x24},
-     {0x40000UL, 0x22},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e1*/
-    {{0x4000UL, 0x16},
-     {0x400UL, 0x12},
-     {0x200000UL, 0x25},
-     {0x80000UL, 0x23},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f1*/
-    {{0x8000UL, 0x17},
-     {0x800UL, 0x13},
-     {0x400000UL, 0x26},
-     {0x100000UL, 0x24},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g1*/
-    {{0x1000UL, 0x14},
-     {0x800000UL, 0x27},
-     {0x200000UL, 0x25},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h1*/
-    {{0x2000UL, 0x15},
-     {0x400000UL, 0x26},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a2*/
-    {{0x40000UL, 0x22},
-     {0x4UL, 0x2},
-     {0x2000000UL, 0x31},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b2*/
-    {{0x80000UL, 0x23},
-     {0x8UL, 0x3},
-     {0x4000000UL, 0x32},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c2*/
-    {{0x100000UL, 0x24},
-     {0x10000UL, 0x20},
-     {0x10UL, 0x4},
-     {0x1UL, 0x0},
-     {0x8000000UL, 0x33},
-     {0x2000000UL, 0x31},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d2*/
-    {{0x200000UL, 0x25},
-     {0x20000UL, 0x21},
-     {0x20UL, 0x5},
-     {0x2UL, 0x1},
-     {0x10000000UL, 0x34},
-     {0x4000000UL, 0x32},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e2*/
-    {{0x400000UL, 0x26},
-     {0x40000UL, 0x22},
-     {0x40UL, 0x6},
-     {0x4UL, 0x2},
-     {0x20000000UL, 0x35},
-     {0x8000000UL, 0x33},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f2*/
-    {{0x800000UL, 0x27},
-     {0x80000UL, 0x23},
-     {0x80UL, 0x7},
-     {0x8UL, 0x3},
-     {0x40000000UL, 0x36},
-     {0x10000000UL, 0x34},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g2*/
-    {{0x100000UL, 0x24},
-     {0x10UL, 0x4},
-     {0x80000000UL, 0x37},
-     {0x20000000UL, 0x35},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h2*/
-    {{0x200000UL, 0x25},
-     {0x20UL, 0x5},
-     {0x40000000UL, 0x36},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a3*/
-    {{0x4000000UL, 0x32},
-     {0x400UL, 0x12},
-     {0x200000000UL, 0x41},
-     {0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b3*/
-    {{0x8000000UL, 0x33},
-     {0x800UL, 0x13},
-     {0x400000000UL, 0x42},
-     {0x100000000UL, 0x40},
-     {0x4UL, 0x2},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c3*/
-    {{0x10000000UL, 0x34},
-     {0x1000000UL, 0x30},
-     {0x1000UL, 0x14},
-     {0x100UL, 0x10},
-     {0x800000000UL, 0x43},
-     {0x200000000UL, 0x41},
-     {0x8UL, 0x3},
-     {0x2UL, 0x1}},
-    /*d3*/
-    {{0x20000000UL, 0x35},
-     {0x2000000UL, 0x31},
-     {0x2000UL, 0x15},
-     {0x200UL, 0x11},
-     {0x1000000000UL, 0x44},
-     {0x400000000UL, 0x42},
-     {0x10UL, 0x4},
-     {0x4UL, 0x2}},
-    /*e3*/
-    {{0x40000000UL, 0x36},
-     {0x4000000UL, 0x32},
-     {0x4000UL, 0x16},
-     {0x400UL, 0x12},
-     {0x2000000000UL, 0x45},
-     {0x800000000UL, 0x43},
-     {0x20UL, 0x5},
-     {0x8UL, 0x3}},
-    /*f3*/
-    {{0x80000000UL, 0x37},
-     {0x8000000UL, 0x33},
-     {0x8000UL, 0x17},
-     {0x800UL, 0x13},
-     {0x4000000000UL, 0x46},
-     {0x1000000000UL, 0x44},
-     {0x40UL, 0x6},
-     {0x10UL, 0x4}},
-    /*g3*/
-    {{0x10000000UL, 0x34},
-     {0x1000UL, 0x14},
-     {0x8000000000UL, 0x47},
-     {0x2000000000UL, 0x45},
-     {0x80UL, 0x7},
-     {0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h3*/
-    {{0x20000000UL, 0x35},
-     {0x2000UL, 0x15},
-     {0x4000000000UL, 0x46},
-     {0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a4*/
-    {{0x400000000UL, 0x42},
-     {0x40000UL, 0x22},
-     {0x20000000000UL, 0x51},
-     {0x200UL, 0x11},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b4*/
-    {{0x800000000UL, 0x43},
-     {0x80000UL, 0x23},
-     {0x40000000000UL, 0x52},
-     {0x10000000000UL, 0x50},
-     {0x400UL, 0x12},
-     {0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c4*/
-    {{0x1000000000UL, 0x44},
-     {0x100000000UL, 0x40},
-     {0x100000UL, 0x24},
-     {0x10000UL, 0x20},
-     {0x80000000000UL, 0x53},
-     {0x20000000000UL, 0x51},
-     {0x800UL, 0x13},
-     {0x200UL, 0x11}},
-    /*d4*/
-    {{0x2000000000UL, 0x45},
-     {0x200000000UL, 0x41},
-     {0x200000UL, 0x25},
-     {0x20000UL, 0x21},
-     {0x100000000000UL, 0x54},
-     {0x40000000000UL, 0x52},
-     {0x1000UL, 0x14},
-     {0x400UL, 0x12}},
-    /*e4*/
-    {{0x4000000000UL, 0x46},
-     {0x400000000UL, 0x42},
-     {0x400000UL, 0x26},
-     {0x40000UL, 0x22},
-     {0x200000000000UL, 0x55},
-     {0x80000000000UL, 0x53},
-     {0x2000UL, 0x15},
-     {0x800UL, 0x13}},
-    /*f4*/
-    {{0x8000000000UL, 0x47},
-     {0x800000000UL, 0x43},
-     {0x800000UL, 0x27},
-     {0x80000UL, 0x23},
-     {0x400000000000UL, 0x56},
-     {0x100000000000UL, 0x54},
-     {0x4000UL, 0x16},
-     {0x1000UL, 0x14}},
-    /*g4*/
-    {{0x1000000000UL, 0x44},
-     {0x100000UL, 0x24},
-     {0x800000000000UL, 0x57},
-     {0x200000000000UL, 0x55},
-     {0x8000UL, 0x17},
-     {0x2000UL, 0x15},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h4*/
-    {{0x2000000000UL, 0x45},
-     {0x200000UL, 0x25},
-     {0x400000000000UL, 0x56},
-     {0x4000UL, 0x16},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a5*/
-    {{0x40000000000UL, 0x52},
-     {0x4000000UL, 0x32},
-     {0x2000000000000UL, 0x61},
-     {0x20000UL, 0x21},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b5*/
-    {{0x80000000000UL, 0x53},
-     {0x8000000UL, 0x33},
-     {0x4000000000000UL, 0x62},
-     {0x1000000000000UL, 0x60},
-     {0x40000UL, 0x22},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c5*/
-    {{0x100000000000UL, 0x54},
-     {0x10000000000UL, 0x50},
-     {0x10000000UL, 0x34},
-     {0x1000000UL, 0x30},
-     {0x8000000000000UL, 0x63},
-     {0x2000000000000UL, 0x61},
-     {0x80000UL, 0x23},
-     {0x20000UL, 0x21}},
-    /*d5*/
-    {{0x200000000000UL, 0x55},
-     {0x20000000000UL, 0x51},
-     {0x20000000UL, 0x35},
-     {0x2000000UL, 0x31},
-     {0x10000000000000UL, 0x64},
-     {0x4000000000000UL, 0x62},
-     {0x100000UL, 0x24},
-     {0x40000UL, 0x22}},
-    /*e5*/
-    {{0x400000000000UL, 0x56},
-     {0x40000000000UL, 0x52},
-     {0x40000000UL, 0x36},
-     {0x4000000UL, 0x32},
-     {0x20000000000000UL, 0x65},
-     {0x8000000000000UL, 0x63},
-     {0x200000UL, 0x25},
-     {0x80000UL, 0x23}},
-    /*f5*/
-    {{0x800000000000UL, 0x57},
-     {0x80000000000UL, 0x53},
-     {0x80000000UL, 0x37},
-     {0x8000000UL, 0x33},
-     {0x40000000000000UL, 0x66},
-     {0x10000000000000UL, 0x64},
-     {0x400000UL, 0x26},
-     {0x100000UL, 0x24}},
-    /*g5*/
-    {{0x100000000000UL, 0x54},
-     {0x10000000UL, 0x34},
-     {0x80000000000000UL, 0x67},
-     {0x20000000000000UL, 0x65},
-     {0x800000UL, 0x27},
-     {0x200000UL, 0x25},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h5*/
-    {{0x200000000000UL, 0x55},
-     {0x20000000UL, 0x35},
-     {0x40000000000000UL, 0x66},
-     {0x400000UL, 0x26},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a6*/
-    {{0x4000000000000UL, 0x62},
-     {0x400000000UL, 0x42},
-     {0x200000000000000UL, 0x71},
-     {0x2000000UL, 0x31},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b6*/
-    {{0x8000000000000UL, 0x63},
-     {0x800000000UL, 0x43},
-     {0x400000000000000UL, 0x72},
-     {0x100000000000000UL, 0x70},
-     {0x4000000UL, 0x32},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c6*/
-    {{0x10000000000000UL, 0x64},
-     {0x1000000000000UL, 0x60},
-     {0x1000000000UL, 0x44},
-     {0x100000000UL, 0x40},
-     {0x800000000000000UL, 0x73},
-     {0x200000000000000UL, 0x71},
-     {0x8000000UL, 0x33},
-     {0x2000000UL, 0x31}},
-    /*d6*/
-    {{0x20000000000000UL, 0x65},
-     {0x2000000000000UL, 0x61},
-     {0x2000000000UL, 0x45},
-     {0x200000000UL, 0x41},
-     {0x1000000000000000UL, 0x74},
-     {0x400000000000000UL, 0x72},
-     {0x10000000UL, 0x34},
-     {0x4000000UL, 0x32}},
-    /*e6*/
-    {{0x40000000000000UL, 0x66},
-     {0x4000000000000UL, 0x62},
-     {0x4000000000UL, 0x46},
-     {0x400000000UL, 0x42},
-     {0x2000000000000000UL, 0x75},
-     {0x800000000000000UL, 0x73},
-     {0x20000000UL, 0x35},
-     {0x8000000UL, 0x33}},
-    /*f6*/
-    {{0x80000000000000UL, 0x67},
-     {0x8000000000000UL, 0x63},
-     {0x8000000000UL, 0x47},
-     {0x800000000UL, 0x43},
-     {0x4000000000000000UL, 0x76},
-     {0x1000000000000000UL, 0x74},
-     {0x40000000UL, 0x36},
-     {0x10000000UL, 0x34}},
-    /*g6*/
-    {{0x10000000000000UL, 0x64},
-     {0x1000000000UL, 0x44},
-     {0x8000000000000000UL, 0x77},
-     {0x2000000000000000UL, 0x75},
-     {0x80000000UL, 0x37},
-     {0x20000000UL, 0x35},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h6*/
-    {{0x20000000000000UL, 0x65},
-     {0x2000000000UL, 0x45},
-     {0x4000000000000000UL, 0x76},
-     {0x40000000UL, 0x36},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a7*/
-    {{0x400000000000000UL, 0x72},
-     {0x40000000000UL, 0x52},
-     {0x200000000UL, 0x41},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b7*/
-    {{0x800000000000000UL, 0x73},
-     {0x80000000000UL, 0x53},
-     {0x400000000UL, 0x42},
-     {0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c7*/
-    {{0x1000000000000000UL, 0x74},
-     {0x100000000000000UL, 0x70},
-     {0x100000000000UL, 0x54},
-     {0x10000000000UL, 0x50},
-     {0x800000000UL, 0x43},
-     {0x200000000UL, 0x41},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d7*/
-    {{0x2000000000000000UL, 0x75},
-     {0x200000000000000UL, 0x71},
-     {0x200000000000UL, 0x55},
-     {0x20000000000UL, 0x51},
-     {0x1000000000UL, 0x44},
-     {0x400000000UL, 0x42},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e7*/
-    {{0x4000000000000000UL, 0x76},
-     {0x400000000000000UL, 0x72},
-     {0x400000000000UL, 0x56},
-     {0x40000000000UL, 0x52},
-     {0x2000000000UL, 0x45},
-     {0x800000000UL, 0x43},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f7*/
-    {{0x8000000000000000UL, 0x77},
-     {0x800000000000000UL, 0x73},
-     {0x800000000000UL, 0x57},
-     {0x80000000000UL, 0x53},
-     {0x4000000000UL, 0x46},
-     {0x1000000000UL, 0x44},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g7*/
-    {{0x1000000000000000UL, 0x74},
-     {0x100000000000UL, 0x54},
-     {0x8000000000UL, 0x47},
-     {0x2000000000UL, 0x45},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h7*/
-    {{0x2000000000000000UL, 0x75},
-     {0x200000000000UL, 0x55},
-     {0x4000000000UL, 0x46},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a8*/
-    {{0x4000000000000UL, 0x62},
-     {0x20000000000UL, 0x51},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b8*/
-    {{0x8000000000000UL, 0x63},
-     {0x40000000000UL, 0x52},
-     {0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c8*/
-    {{0x10000000000000UL, 0x64},
-     {0x1000000000000UL, 0x60},
-     {0x80000000000UL, 0x53},
-     {0x20000000000UL, 0x51},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d8*/
-    {{0x20000000000000UL, 0x65},
-     {0x2000000000000UL, 0x61},
-     {0x100000000000UL, 0x54},
-     {0x40000000000UL, 0x52},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e8*/
-    {{0x40000000000000UL, 0x66},
-     {0x4000000000000UL, 0x62},
-     {0x200000000000UL, 0x55},
-     {0x80000000000UL, 0x53},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f8*/
-    {{0x80000000000000UL, 0x67},
-     {0x8000000000000UL, 0x63},
-     {0x400000000000UL, 0x56},
-     {0x100000000000UL, 0x54},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g8*/
-    {{0x10000000000000UL, 0x64},
-     {0x800000000000UL, 0x57},
-     {0x200000000000UL, 0x55},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h8*/
-    {{0x20000000000000UL, 0x65},
-     {0x400000000000UL, 0x56},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-};
 const uint64_t WHITE_PAWN_CAPTURES[64] = {
     /*a1*/ 0x200UL,
     /*b1*/ 0x500UL,
@@ -1420,4621 +266,1233 @@ const uint64_t BLACK_PAWN_CAPTURES[64] = {
     /*g8*/ 0xa0000000000000UL,
     /*h8*/ 0x40000000000000UL,
 };
-const bboard_and_square_t BISHOP_RAY_NE[64][8] = {
-    /*a1*/ {{0x200UL, 0x11},
-            {0x40000UL, 0x22},
-            {0x8000000UL, 0x33},
-            {0x1000000000UL, 0x44},
-            {0x200000000000UL, 0x55},
-            {0x40000000000000UL, 0x66},
-            {0x8000000000000000UL, 0x77},
-            {0, 0x88}},
-    /*b1*/
-    {{0x400UL, 0x12},
-     {0x80000UL, 0x23},
-     {0x10000000UL, 0x34},
-     {0x2000000000UL, 0x45},
-     {0x400000000000UL, 0x56},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c1*/
-    {{0x800UL, 0x13},
-     {0x100000UL, 0x24},
-     {0x20000000UL, 0x35},
-     {0x4000000000UL, 0x46},
-     {0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d1*/
-    {{0x1000UL, 0x14},
-     {0x200000UL, 0x25},
-     {0x40000000UL, 0x36},
-     {0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e1*/
-    {{0x2000UL, 0x15},
-     {0x400000UL, 0x26},
-     {0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f1*/
-    {{0x4000UL, 0x16},
-     {0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g1*/
-    {{0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a2*/
-    {{0x20000UL, 0x21},
-     {0x4000000UL, 0x32},
-     {0x800000000UL, 0x43},
-     {0x100000000000UL, 0x54},
-     {0x20000000000000UL, 0x65},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b2*/
-    {{0x40000UL, 0x22},
-     {0x8000000UL, 0x33},
-     {0x1000000000UL, 0x44},
-     {0x200000000000UL, 0x55},
-     {0x40000000000000UL, 0x66},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c2*/
-    {{0x80000UL, 0x23},
-     {0x10000000UL, 0x34},
-     {0x2000000000UL, 0x45},
-     {0x400000000000UL, 0x56},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d2*/
-    {{0x100000UL, 0x24},
-     {0x20000000UL, 0x35},
-     {0x4000000000UL, 0x46},
-     {0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e2*/
-    {{0x200000UL, 0x25},
-     {0x40000000UL, 0x36},
-     {0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f2*/
-    {{0x400000UL, 0x26},
-     {0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g2*/
-    {{0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h2*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a3*/
-    {{0x2000000UL, 0x31},
-     {0x400000000UL, 0x42},
-     {0x80000000000UL, 0x53},
-     {0x10000000000000UL, 0x64},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b3*/
-    {{0x4000000UL, 0x32},
-     {0x800000000UL, 0x43},
-     {0x100000000000UL, 0x54},
-     {0x20000000000000UL, 0x65},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c3*/
-    {{0x8000000UL, 0x33},
-     {0x1000000000UL, 0x44},
-     {0x200000000000UL, 0x55},
-     {0x40000000000000UL, 0x66},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d3*/
-    {{0x10000000UL, 0x34},
-     {0x2000000000UL, 0x45},
-     {0x400000000000UL, 0x56},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e3*/
-    {{0x20000000UL, 0x35},
-     {0x4000000000UL, 0x46},
-     {0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f3*/
-    {{0x40000000UL, 0x36},
-     {0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g3*/
-    {{0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h3*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a4*/
-    {{0x200000000UL, 0x41},
-     {0x40000000000UL, 0x52},
-     {0x8000000000000UL, 0x63},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b4*/
-    {{0x400000000UL, 0x42},
-     {0x80000000000UL, 0x53},
-     {0x10000000000000UL, 0x64},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c4*/
-    {{0x800000000UL, 0x43},
-     {0x100000000000UL, 0x54},
-     {0x20000000000000UL, 0x65},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d4*/
-    {{0x1000000000UL, 0x44},
-     {0x200000000000UL, 0x55},
-     {0x40000000000000UL, 0x66},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e4*/
-    {{0x2000000000UL, 0x45},
-     {0x400000000000UL, 0x56},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f4*/
-    {{0x4000000000UL, 0x46},
-     {0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g4*/
-    {{0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h4*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a5*/
-    {{0x20000000000UL, 0x51},
-     {0x4000000000000UL, 0x62},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b5*/
-    {{0x40000000000UL, 0x52},
-     {0x8000000000000UL, 0x63},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c5*/
-    {{0x80000000000UL, 0x53},
-     {0x10000000000000UL, 0x64},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d5*/
-    {{0x100000000000UL, 0x54},
-     {0x20000000000000UL, 0x65},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e5*/
-    {{0x200000000000UL, 0x55},
-     {0x40000000000000UL, 0x66},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f5*/
-    {{0x400000000000UL, 0x56},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g5*/
-    {{0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h5*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a6*/
-    {{0x2000000000000UL, 0x61},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b6*/
-    {{0x4000000000000UL, 0x62},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c6*/
-    {{0x8000000000000UL, 0x63},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d6*/
-    {{0x10000000000000UL, 0x64},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e6*/
-    {{0x20000000000000UL, 0x65},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f6*/
-    {{0x40000000000000UL, 0x66},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g6*/
-    {{0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h6*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a7*/
-    {{0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b7*/
-    {{0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c7*/
-    {{0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d7*/
-    {{0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e7*/
-    {{0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f7*/
-    {{0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g7*/
-    {{0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h7*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
+const uint64_t BISHOP_RAY_NE[64][8] = {
+    /*a1*/ {0x200UL, 0x40000UL, 0x8000000UL, 0x1000000000UL, 0x200000000000UL,
+            0x40000000000000UL, 0x8000000000000000UL, 0},
+    /*b1*/ {0x400UL, 0x80000UL, 0x10000000UL, 0x2000000000UL, 0x400000000000UL,
+            0x80000000000000UL, 0, 0},
+    /*c1*/ {0x800UL, 0x100000UL, 0x20000000UL, 0x4000000000UL, 0x800000000000UL,
+            0, 0, 0},
+    /*d1*/ {0x1000UL, 0x200000UL, 0x40000000UL, 0x8000000000UL, 0, 0, 0, 0},
+    /*e1*/ {0x2000UL, 0x400000UL, 0x80000000UL, 0, 0, 0, 0, 0},
+    /*f1*/ {0x4000UL, 0x800000UL, 0, 0, 0, 0, 0, 0},
+    /*g1*/ {0x8000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a2*/ {0x20000UL, 0x4000000UL, 0x800000000UL, 0x100000000000UL,
+            0x20000000000000UL, 0x4000000000000000UL, 0, 0},
+    /*b2*/ {0x40000UL, 0x8000000UL, 0x1000000000UL, 0x200000000000UL,
+            0x40000000000000UL, 0x8000000000000000UL, 0, 0},
+    /*c2*/ {0x80000UL, 0x10000000UL, 0x2000000000UL, 0x400000000000UL,
+            0x80000000000000UL, 0, 0, 0},
+    /*d2*/ {0x100000UL, 0x20000000UL, 0x4000000000UL, 0x800000000000UL, 0, 0, 0,
+            0},
+    /*e2*/ {0x200000UL, 0x40000000UL, 0x8000000000UL, 0, 0, 0, 0, 0},
+    /*f2*/ {0x400000UL, 0x80000000UL, 0, 0, 0, 0, 0, 0},
+    /*g2*/ {0x800000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h2*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a3*/ {0x2000000UL, 0x400000000UL, 0x80000000000UL, 0x10000000000000UL,
+            0x2000000000000000UL, 0, 0, 0},
+    /*b3*/ {0x4000000UL, 0x800000000UL, 0x100000000000UL, 0x20000000000000UL,
+            0x4000000000000000UL, 0, 0, 0},
+    /*c3*/ {0x8000000UL, 0x1000000000UL, 0x200000000000UL, 0x40000000000000UL,
+            0x8000000000000000UL, 0, 0, 0},
+    /*d3*/ {0x10000000UL, 0x2000000000UL, 0x400000000000UL, 0x80000000000000UL,
+            0, 0, 0, 0},
+    /*e3*/ {0x20000000UL, 0x4000000000UL, 0x800000000000UL, 0, 0, 0, 0, 0},
+    /*f3*/ {0x40000000UL, 0x8000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g3*/ {0x80000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h3*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a4*/ {0x200000000UL, 0x40000000000UL, 0x8000000000000UL,
+            0x1000000000000000UL, 0, 0, 0, 0},
+    /*b4*/ {0x400000000UL, 0x80000000000UL, 0x10000000000000UL,
+            0x2000000000000000UL, 0, 0, 0, 0},
+    /*c4*/ {0x800000000UL, 0x100000000000UL, 0x20000000000000UL,
+            0x4000000000000000UL, 0, 0, 0, 0},
+    /*d4*/ {0x1000000000UL, 0x200000000000UL, 0x40000000000000UL,
+            0x8000000000000000UL, 0, 0, 0, 0},
+    /*e4*/ {0x2000000000UL, 0x400000000000UL, 0x80000000000000UL, 0, 0, 0, 0,
+            0},
+    /*f4*/ {0x4000000000UL, 0x800000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g4*/ {0x8000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h4*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a5*/ {0x20000000000UL, 0x4000000000000UL, 0x800000000000000UL, 0, 0, 0, 0,
+            0},
+    /*b5*/ {0x40000000000UL, 0x8000000000000UL, 0x1000000000000000UL, 0, 0, 0,
+            0, 0},
+    /*c5*/ {0x80000000000UL, 0x10000000000000UL, 0x2000000000000000UL, 0, 0, 0,
+            0, 0},
+    /*d5*/ {0x100000000000UL, 0x20000000000000UL, 0x4000000000000000UL, 0, 0, 0,
+            0, 0},
+    /*e5*/ {0x200000000000UL, 0x40000000000000UL, 0x8000000000000000UL, 0, 0, 0,
+            0, 0},
+    /*f5*/ {0x400000000000UL, 0x80000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g5*/ {0x800000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h5*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a6*/ {0x2000000000000UL, 0x400000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*b6*/ {0x4000000000000UL, 0x800000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*c6*/ {0x8000000000000UL, 0x1000000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*d6*/ {0x10000000000000UL, 0x2000000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*e6*/ {0x20000000000000UL, 0x4000000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*f6*/ {0x40000000000000UL, 0x8000000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g6*/ {0x80000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h6*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a7*/ {0x200000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*b7*/ {0x400000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c7*/ {0x800000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*d7*/ {0x1000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*e7*/ {0x2000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*f7*/ {0x4000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*g7*/ {0x8000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h7*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*c8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*d8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*e8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*f8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*g8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*h8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+};
+const uint64_t BISHOP_RAY_SE[64][8] = {
+    /*a1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*c1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*d1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*e1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*f1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*g1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*h1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a2*/ {0x2UL, 0, 0, 0, 0, 0, 0, 0},
+    /*b2*/ {0x4UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c2*/ {0x8UL, 0, 0, 0, 0, 0, 0, 0},
+    /*d2*/ {0x10UL, 0, 0, 0, 0, 0, 0, 0},
+    /*e2*/ {0x20UL, 0, 0, 0, 0, 0, 0, 0},
+    /*f2*/ {0x40UL, 0, 0, 0, 0, 0, 0, 0},
+    /*g2*/ {0x80UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h2*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a3*/ {0x200UL, 0x4UL, 0, 0, 0, 0, 0, 0},
+    /*b3*/ {0x400UL, 0x8UL, 0, 0, 0, 0, 0, 0},
+    /*c3*/ {0x800UL, 0x10UL, 0, 0, 0, 0, 0, 0},
+    /*d3*/ {0x1000UL, 0x20UL, 0, 0, 0, 0, 0, 0},
+    /*e3*/ {0x2000UL, 0x40UL, 0, 0, 0, 0, 0, 0},
+    /*f3*/ {0x4000UL, 0x80UL, 0, 0, 0, 0, 0, 0},
+    /*g3*/ {0x8000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h3*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a4*/ {0x20000UL, 0x400UL, 0x8UL, 0, 0, 0, 0, 0},
+    /*b4*/ {0x40000UL, 0x800UL, 0x10UL, 0, 0, 0, 0, 0},
+    /*c4*/ {0x80000UL, 0x1000UL, 0x20UL, 0, 0, 0, 0, 0},
+    /*d4*/ {0x100000UL, 0x2000UL, 0x40UL, 0, 0, 0, 0, 0},
+    /*e4*/ {0x200000UL, 0x4000UL, 0x80UL, 0, 0, 0, 0, 0},
+    /*f4*/ {0x400000UL, 0x8000UL, 0, 0, 0, 0, 0, 0},
+    /*g4*/ {0x800000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h4*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a5*/ {0x2000000UL, 0x40000UL, 0x800UL, 0x10UL, 0, 0, 0, 0},
+    /*b5*/ {0x4000000UL, 0x80000UL, 0x1000UL, 0x20UL, 0, 0, 0, 0},
+    /*c5*/ {0x8000000UL, 0x100000UL, 0x2000UL, 0x40UL, 0, 0, 0, 0},
+    /*d5*/ {0x10000000UL, 0x200000UL, 0x4000UL, 0x80UL, 0, 0, 0, 0},
+    /*e5*/ {0x20000000UL, 0x400000UL, 0x8000UL, 0, 0, 0, 0, 0},
+    /*f5*/ {0x40000000UL, 0x800000UL, 0, 0, 0, 0, 0, 0},
+    /*g5*/ {0x80000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h5*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a6*/ {0x200000000UL, 0x4000000UL, 0x80000UL, 0x1000UL, 0x20UL, 0, 0, 0},
+    /*b6*/ {0x400000000UL, 0x8000000UL, 0x100000UL, 0x2000UL, 0x40UL, 0, 0, 0},
+    /*c6*/ {0x800000000UL, 0x10000000UL, 0x200000UL, 0x4000UL, 0x80UL, 0, 0, 0},
+    /*d6*/ {0x1000000000UL, 0x20000000UL, 0x400000UL, 0x8000UL, 0, 0, 0, 0},
+    /*e6*/ {0x2000000000UL, 0x40000000UL, 0x800000UL, 0, 0, 0, 0, 0},
+    /*f6*/ {0x4000000000UL, 0x80000000UL, 0, 0, 0, 0, 0, 0},
+    /*g6*/ {0x8000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h6*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a7*/ {0x20000000000UL, 0x400000000UL, 0x8000000UL, 0x100000UL, 0x2000UL,
+            0x40UL, 0, 0},
+    /*b7*/ {0x40000000000UL, 0x800000000UL, 0x10000000UL, 0x200000UL, 0x4000UL,
+            0x80UL, 0, 0},
+    /*c7*/ {0x80000000000UL, 0x1000000000UL, 0x20000000UL, 0x400000UL, 0x8000UL,
+            0, 0, 0},
+    /*d7*/ {0x100000000000UL, 0x2000000000UL, 0x40000000UL, 0x800000UL, 0, 0, 0,
+            0},
+    /*e7*/ {0x200000000000UL, 0x4000000000UL, 0x80000000UL, 0, 0, 0, 0, 0},
+    /*f7*/ {0x400000000000UL, 0x8000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g7*/ {0x800000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h7*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a8*/ {0x2000000000000UL, 0x40000000000UL, 0x800000000UL, 0x10000000UL,
+            0x200000UL, 0x4000UL, 0x80UL, 0},
+    /*b8*/ {0x4000000000000UL, 0x80000000000UL, 0x1000000000UL, 0x20000000UL,
+            0x400000UL, 0x8000UL, 0, 0},
+    /*c8*/ {0x8000000000000UL, 0x100000000000UL, 0x2000000000UL, 0x40000000UL,
+            0x800000UL, 0, 0, 0},
+    /*d8*/ {0x10000000000000UL, 0x200000000000UL, 0x4000000000UL, 0x80000000UL,
+            0, 0, 0, 0},
+    /*e8*/ {0x20000000000000UL, 0x400000000000UL, 0x8000000000UL, 0, 0, 0, 0,
+            0},
+    /*f8*/ {0x40000000000000UL, 0x800000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g8*/ {0x80000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+};
+const uint64_t BISHOP_RAY_NW[64][8] = {
+    /*a1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b1*/ {0x100UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c1*/ {0x200UL, 0x10000UL, 0, 0, 0, 0, 0, 0},
+    /*d1*/ {0x400UL, 0x20000UL, 0x1000000UL, 0, 0, 0, 0, 0},
+    /*e1*/ {0x800UL, 0x40000UL, 0x2000000UL, 0x100000000UL, 0, 0, 0, 0},
+    /*f1*/ {0x1000UL, 0x80000UL, 0x4000000UL, 0x200000000UL, 0x10000000000UL, 0,
+            0, 0},
+    /*g1*/ {0x2000UL, 0x100000UL, 0x8000000UL, 0x400000000UL, 0x20000000000UL,
+            0x1000000000000UL, 0, 0},
+    /*h1*/ {0x4000UL, 0x200000UL, 0x10000000UL, 0x800000000UL, 0x40000000000UL,
+            0x2000000000000UL, 0x100000000000000UL, 0},
+    /*a2*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b2*/ {0x10000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c2*/ {0x20000UL, 0x1000000UL, 0, 0, 0, 0, 0, 0},
+    /*d2*/ {0x40000UL, 0x2000000UL, 0x100000000UL, 0, 0, 0, 0, 0},
+    /*e2*/ {0x80000UL, 0x4000000UL, 0x200000000UL, 0x10000000000UL, 0, 0, 0, 0},
+    /*f2*/ {0x100000UL, 0x8000000UL, 0x400000000UL, 0x20000000000UL,
+            0x1000000000000UL, 0, 0, 0},
+    /*g2*/ {0x200000UL, 0x10000000UL, 0x800000000UL, 0x40000000000UL,
+            0x2000000000000UL, 0x100000000000000UL, 0, 0},
+    /*h2*/ {0x400000UL, 0x20000000UL, 0x1000000000UL, 0x80000000000UL,
+            0x4000000000000UL, 0x200000000000000UL, 0, 0},
+    /*a3*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b3*/ {0x1000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c3*/ {0x2000000UL, 0x100000000UL, 0, 0, 0, 0, 0, 0},
+    /*d3*/ {0x4000000UL, 0x200000000UL, 0x10000000000UL, 0, 0, 0, 0, 0},
+    /*e3*/ {0x8000000UL, 0x400000000UL, 0x20000000000UL, 0x1000000000000UL, 0,
+            0, 0, 0},
+    /*f3*/ {0x10000000UL, 0x800000000UL, 0x40000000000UL, 0x2000000000000UL,
+            0x100000000000000UL, 0, 0, 0},
+    /*g3*/ {0x20000000UL, 0x1000000000UL, 0x80000000000UL, 0x4000000000000UL,
+            0x200000000000000UL, 0, 0, 0},
+    /*h3*/ {0x40000000UL, 0x2000000000UL, 0x100000000000UL, 0x8000000000000UL,
+            0x400000000000000UL, 0, 0, 0},
+    /*a4*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b4*/ {0x100000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c4*/ {0x200000000UL, 0x10000000000UL, 0, 0, 0, 0, 0, 0},
+    /*d4*/ {0x400000000UL, 0x20000000000UL, 0x1000000000000UL, 0, 0, 0, 0, 0},
+    /*e4*/ {0x800000000UL, 0x40000000000UL, 0x2000000000000UL,
+            0x100000000000000UL, 0, 0, 0, 0},
+    /*f4*/ {0x1000000000UL, 0x80000000000UL, 0x4000000000000UL,
+            0x200000000000000UL, 0, 0, 0, 0},
+    /*g4*/ {0x2000000000UL, 0x100000000000UL, 0x8000000000000UL,
+            0x400000000000000UL, 0, 0, 0, 0},
+    /*h4*/ {0x4000000000UL, 0x200000000000UL, 0x10000000000000UL,
+            0x800000000000000UL, 0, 0, 0, 0},
+    /*a5*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b5*/ {0x10000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c5*/ {0x20000000000UL, 0x1000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*d5*/ {0x40000000000UL, 0x2000000000000UL, 0x100000000000000UL, 0, 0, 0, 0,
+            0},
+    /*e5*/ {0x80000000000UL, 0x4000000000000UL, 0x200000000000000UL, 0, 0, 0, 0,
+            0},
+    /*f5*/ {0x100000000000UL, 0x8000000000000UL, 0x400000000000000UL, 0, 0, 0,
+            0, 0},
+    /*g5*/ {0x200000000000UL, 0x10000000000000UL, 0x800000000000000UL, 0, 0, 0,
+            0, 0},
+    /*h5*/ {0x400000000000UL, 0x20000000000000UL, 0x1000000000000000UL, 0, 0, 0,
+            0, 0},
+    /*a6*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b6*/ {0x1000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c6*/ {0x2000000000000UL, 0x100000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*d6*/ {0x4000000000000UL, 0x200000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*e6*/ {0x8000000000000UL, 0x400000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*f6*/ {0x10000000000000UL, 0x800000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g6*/ {0x20000000000000UL, 0x1000000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*h6*/ {0x40000000000000UL, 0x2000000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*a7*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b7*/ {0x100000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c7*/ {0x200000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*d7*/ {0x400000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*e7*/ {0x800000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*f7*/ {0x1000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*g7*/ {0x2000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h7*/ {0x4000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*a8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*c8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*d8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*e8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*f8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*g8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*h8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+};
+const uint64_t BISHOP_RAY_SW[64][8] = {
+    /*a1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*c1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*d1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*e1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*f1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*g1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*h1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a2*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b2*/ {0x1UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c2*/ {0x2UL, 0, 0, 0, 0, 0, 0, 0},
+    /*d2*/ {0x4UL, 0, 0, 0, 0, 0, 0, 0},
+    /*e2*/ {0x8UL, 0, 0, 0, 0, 0, 0, 0},
+    /*f2*/ {0x10UL, 0, 0, 0, 0, 0, 0, 0},
+    /*g2*/ {0x20UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h2*/ {0x40UL, 0, 0, 0, 0, 0, 0, 0},
+    /*a3*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b3*/ {0x100UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c3*/ {0x200UL, 0x1UL, 0, 0, 0, 0, 0, 0},
+    /*d3*/ {0x400UL, 0x2UL, 0, 0, 0, 0, 0, 0},
+    /*e3*/ {0x800UL, 0x4UL, 0, 0, 0, 0, 0, 0},
+    /*f3*/ {0x1000UL, 0x8UL, 0, 0, 0, 0, 0, 0},
+    /*g3*/ {0x2000UL, 0x10UL, 0, 0, 0, 0, 0, 0},
+    /*h3*/ {0x4000UL, 0x20UL, 0, 0, 0, 0, 0, 0},
+    /*a4*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b4*/ {0x10000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c4*/ {0x20000UL, 0x100UL, 0, 0, 0, 0, 0, 0},
+    /*d4*/ {0x40000UL, 0x200UL, 0x1UL, 0, 0, 0, 0, 0},
+    /*e4*/ {0x80000UL, 0x400UL, 0x2UL, 0, 0, 0, 0, 0},
+    /*f4*/ {0x100000UL, 0x800UL, 0x4UL, 0, 0, 0, 0, 0},
+    /*g4*/ {0x200000UL, 0x1000UL, 0x8UL, 0, 0, 0, 0, 0},
+    /*h4*/ {0x400000UL, 0x2000UL, 0x10UL, 0, 0, 0, 0, 0},
+    /*a5*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b5*/ {0x1000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c5*/ {0x2000000UL, 0x10000UL, 0, 0, 0, 0, 0, 0},
+    /*d5*/ {0x4000000UL, 0x20000UL, 0x100UL, 0, 0, 0, 0, 0},
+    /*e5*/ {0x8000000UL, 0x40000UL, 0x200UL, 0x1UL, 0, 0, 0, 0},
+    /*f5*/ {0x10000000UL, 0x80000UL, 0x400UL, 0x2UL, 0, 0, 0, 0},
+    /*g5*/ {0x20000000UL, 0x100000UL, 0x800UL, 0x4UL, 0, 0, 0, 0},
+    /*h5*/ {0x40000000UL, 0x200000UL, 0x1000UL, 0x8UL, 0, 0, 0, 0},
+    /*a6*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b6*/ {0x100000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c6*/ {0x200000000UL, 0x1000000UL, 0, 0, 0, 0, 0, 0},
+    /*d6*/ {0x400000000UL, 0x2000000UL, 0x10000UL, 0, 0, 0, 0, 0},
+    /*e6*/ {0x800000000UL, 0x4000000UL, 0x20000UL, 0x100UL, 0, 0, 0, 0},
+    /*f6*/ {0x1000000000UL, 0x8000000UL, 0x40000UL, 0x200UL, 0x1UL, 0, 0, 0},
+    /*g6*/ {0x2000000000UL, 0x10000000UL, 0x80000UL, 0x400UL, 0x2UL, 0, 0, 0},
+    /*h6*/ {0x4000000000UL, 0x20000000UL, 0x100000UL, 0x800UL, 0x4UL, 0, 0, 0},
+    /*a7*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b7*/ {0x10000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c7*/ {0x20000000000UL, 0x100000000UL, 0, 0, 0, 0, 0, 0},
+    /*d7*/ {0x40000000000UL, 0x200000000UL, 0x1000000UL, 0, 0, 0, 0, 0},
+    /*e7*/ {0x80000000000UL, 0x400000000UL, 0x2000000UL, 0x10000UL, 0, 0, 0, 0},
+    /*f7*/ {0x100000000000UL, 0x800000000UL, 0x4000000UL, 0x20000UL, 0x100UL, 0,
+            0, 0},
+    /*g7*/ {0x200000000000UL, 0x1000000000UL, 0x8000000UL, 0x40000UL, 0x200UL,
+            0x1UL, 0, 0},
+    /*h7*/ {0x400000000000UL, 0x2000000000UL, 0x10000000UL, 0x80000UL, 0x400UL,
+            0x2UL, 0, 0},
+    /*a8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b8*/ {0x1000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c8*/ {0x2000000000000UL, 0x10000000000UL, 0, 0, 0, 0, 0, 0},
+    /*d8*/ {0x4000000000000UL, 0x20000000000UL, 0x100000000UL, 0, 0, 0, 0, 0},
+    /*e8*/ {0x8000000000000UL, 0x40000000000UL, 0x200000000UL, 0x1000000UL, 0,
+            0, 0, 0},
+    /*f8*/ {0x10000000000000UL, 0x80000000000UL, 0x400000000UL, 0x2000000UL,
+            0x10000UL, 0, 0, 0},
+    /*g8*/ {0x20000000000000UL, 0x100000000000UL, 0x800000000UL, 0x4000000UL,
+            0x20000UL, 0x100UL, 0, 0},
+    /*h8*/ {0x40000000000000UL, 0x200000000000UL, 0x1000000000UL, 0x8000000UL,
+            0x40000UL, 0x200UL, 0x1UL, 0},
+};
+const uint64_t ROOK_RAY_N[64][8] = {
+    /*a1*/ {0x100UL, 0x10000UL, 0x1000000UL, 0x100000000UL, 0x10000000000UL,
+            0x1000000000000UL, 0x100000000000000UL, 0},
+    /*b1*/ {0x200UL, 0x20000UL, 0x2000000UL, 0x200000000UL, 0x20000000000UL,
+            0x2000000000000UL, 0x200000000000000UL, 0},
+    /*c1*/ {0x400UL, 0x40000UL, 0x4000000UL, 0x400000000UL, 0x40000000000UL,
+            0x4000000000000UL, 0x400000000000000UL, 0},
+    /*d1*/ {0x800UL, 0x80000UL, 0x8000000UL, 0x800000000UL, 0x80000000000UL,
+            0x8000000000000UL, 0x800000000000000UL, 0},
+    /*e1*/ {0x1000UL, 0x100000UL, 0x10000000UL, 0x1000000000UL,
+            0x100000000000UL, 0x10000000000000UL, 0x1000000000000000UL, 0},
+    /*f1*/ {0x2000UL, 0x200000UL, 0x20000000UL, 0x2000000000UL,
+            0x200000000000UL, 0x20000000000000UL, 0x2000000000000000UL, 0},
+    /*g1*/ {0x4000UL, 0x400000UL, 0x40000000UL, 0x4000000000UL,
+            0x400000000000UL, 0x40000000000000UL, 0x4000000000000000UL, 0},
+    /*h1*/ {0x8000UL, 0x800000UL, 0x80000000UL, 0x8000000000UL,
+            0x800000000000UL, 0x80000000000000UL, 0x8000000000000000UL, 0},
+    /*a2*/ {0x10000UL, 0x1000000UL, 0x100000000UL, 0x10000000000UL,
+            0x1000000000000UL, 0x100000000000000UL, 0, 0},
+    /*b2*/ {0x20000UL, 0x2000000UL, 0x200000000UL, 0x20000000000UL,
+            0x2000000000000UL, 0x200000000000000UL, 0, 0},
+    /*c2*/ {0x40000UL, 0x4000000UL, 0x400000000UL, 0x40000000000UL,
+            0x4000000000000UL, 0x400000000000000UL, 0, 0},
+    /*d2*/ {0x80000UL, 0x8000000UL, 0x800000000UL, 0x80000000000UL,
+            0x8000000000000UL, 0x800000000000000UL, 0, 0},
+    /*e2*/ {0x100000UL, 0x10000000UL, 0x1000000000UL, 0x100000000000UL,
+            0x10000000000000UL, 0x1000000000000000UL, 0, 0},
+    /*f2*/ {0x200000UL, 0x20000000UL, 0x2000000000UL, 0x200000000000UL,
+            0x20000000000000UL, 0x2000000000000000UL, 0, 0},
+    /*g2*/ {0x400000UL, 0x40000000UL, 0x4000000000UL, 0x400000000000UL,
+            0x40000000000000UL, 0x4000000000000000UL, 0, 0},
+    /*h2*/ {0x800000UL, 0x80000000UL, 0x8000000000UL, 0x800000000000UL,
+            0x80000000000000UL, 0x8000000000000000UL, 0, 0},
+    /*a3*/ {0x1000000UL, 0x100000000UL, 0x10000000000UL, 0x1000000000000UL,
+            0x100000000000000UL, 0, 0, 0},
+    /*b3*/ {0x2000000UL, 0x200000000UL, 0x20000000000UL, 0x2000000000000UL,
+            0x200000000000000UL, 0, 0, 0},
+    /*c3*/ {0x4000000UL, 0x400000000UL, 0x40000000000UL, 0x4000000000000UL,
+            0x400000000000000UL, 0, 0, 0},
+    /*d3*/ {0x8000000UL, 0x800000000UL, 0x80000000000UL, 0x8000000000000UL,
+            0x800000000000000UL, 0, 0, 0},
+    /*e3*/ {0x10000000UL, 0x1000000000UL, 0x100000000000UL, 0x10000000000000UL,
+            0x1000000000000000UL, 0, 0, 0},
+    /*f3*/ {0x20000000UL, 0x2000000000UL, 0x200000000000UL, 0x20000000000000UL,
+            0x2000000000000000UL, 0, 0, 0},
+    /*g3*/ {0x40000000UL, 0x4000000000UL, 0x400000000000UL, 0x40000000000000UL,
+            0x4000000000000000UL, 0, 0, 0},
+    /*h3*/ {0x80000000UL, 0x8000000000UL, 0x800000000000UL, 0x80000000000000UL,
+            0x8000000000000000UL, 0, 0, 0},
+    /*a4*/ {0x100000000UL, 0x10000000000UL, 0x1000000000000UL,
+            0x100000000000000UL, 0, 0, 0, 0},
+    /*b4*/ {0x200000000UL, 0x20000000000UL, 0x2000000000000UL,
+            0x200000000000000UL, 0, 0, 0, 0},
+    /*c4*/ {0x400000000UL, 0x40000000000UL, 0x4000000000000UL,
+            0x400000000000000UL, 0, 0, 0, 0},
+    /*d4*/ {0x800000000UL, 0x80000000000UL, 0x8000000000000UL,
+            0x800000000000000UL, 0, 0, 0, 0},
+    /*e4*/ {0x1000000000UL, 0x100000000000UL, 0x10000000000000UL,
+            0x1000000000000000UL, 0, 0, 0, 0},
+    /*f4*/ {0x2000000000UL, 0x200000000000UL, 0x20000000000000UL,
+            0x2000000000000000UL, 0, 0, 0, 0},
+    /*g4*/ {0x4000000000UL, 0x400000000000UL, 0x40000000000000UL,
+            0x4000000000000000UL, 0, 0, 0, 0},
+    /*h4*/ {0x8000000000UL, 0x800000000000UL, 0x80000000000000UL,
+            0x8000000000000000UL, 0, 0, 0, 0},
+    /*a5*/ {0x10000000000UL, 0x1000000000000UL, 0x100000000000000UL, 0, 0, 0, 0,
+            0},
+    /*b5*/ {0x20000000000UL, 0x2000000000000UL, 0x200000000000000UL, 0, 0, 0, 0,
+            0},
+    /*c5*/ {0x40000000000UL, 0x4000000000000UL, 0x400000000000000UL, 0, 0, 0, 0,
+            0},
+    /*d5*/ {0x80000000000UL, 0x8000000000000UL, 0x800000000000000UL, 0, 0, 0, 0,
+            0},
+    /*e5*/ {0x100000000000UL, 0x10000000000000UL, 0x1000000000000000UL, 0, 0, 0,
+            0, 0},
+    /*f5*/ {0x200000000000UL, 0x20000000000000UL, 0x2000000000000000UL, 0, 0, 0,
+            0, 0},
+    /*g5*/ {0x400000000000UL, 0x40000000000000UL, 0x4000000000000000UL, 0, 0, 0,
+            0, 0},
+    /*h5*/ {0x800000000000UL, 0x80000000000000UL, 0x8000000000000000UL, 0, 0, 0,
+            0, 0},
+    /*a6*/ {0x1000000000000UL, 0x100000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*b6*/ {0x2000000000000UL, 0x200000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*c6*/ {0x4000000000000UL, 0x400000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*d6*/ {0x8000000000000UL, 0x800000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*e6*/ {0x10000000000000UL, 0x1000000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*f6*/ {0x20000000000000UL, 0x2000000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g6*/ {0x40000000000000UL, 0x4000000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*h6*/ {0x80000000000000UL, 0x8000000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*a7*/ {0x100000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*b7*/ {0x200000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c7*/ {0x400000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*d7*/ {0x800000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*e7*/ {0x1000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*f7*/ {0x2000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*g7*/ {0x4000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h7*/ {0x8000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*a8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*c8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*d8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*e8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*f8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*g8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*h8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+};
+const uint64_t ROOK_RAY_S[64][8] = {
+    /*a1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*c1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*d1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*e1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*f1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*g1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*h1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a2*/ {0x1UL, 0, 0, 0, 0, 0, 0, 0},
+    /*b2*/ {0x2UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c2*/ {0x4UL, 0, 0, 0, 0, 0, 0, 0},
+    /*d2*/ {0x8UL, 0, 0, 0, 0, 0, 0, 0},
+    /*e2*/ {0x10UL, 0, 0, 0, 0, 0, 0, 0},
+    /*f2*/ {0x20UL, 0, 0, 0, 0, 0, 0, 0},
+    /*g2*/ {0x40UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h2*/ {0x80UL, 0, 0, 0, 0, 0, 0, 0},
+    /*a3*/ {0x100UL, 0x1UL, 0, 0, 0, 0, 0, 0},
+    /*b3*/ {0x200UL, 0x2UL, 0, 0, 0, 0, 0, 0},
+    /*c3*/ {0x400UL, 0x4UL, 0, 0, 0, 0, 0, 0},
+    /*d3*/ {0x800UL, 0x8UL, 0, 0, 0, 0, 0, 0},
+    /*e3*/ {0x1000UL, 0x10UL, 0, 0, 0, 0, 0, 0},
+    /*f3*/ {0x2000UL, 0x20UL, 0, 0, 0, 0, 0, 0},
+    /*g3*/ {0x4000UL, 0x40UL, 0, 0, 0, 0, 0, 0},
+    /*h3*/ {0x8000UL, 0x80UL, 0, 0, 0, 0, 0, 0},
+    /*a4*/ {0x10000UL, 0x100UL, 0x1UL, 0, 0, 0, 0, 0},
+    /*b4*/ {0x20000UL, 0x200UL, 0x2UL, 0, 0, 0, 0, 0},
+    /*c4*/ {0x40000UL, 0x400UL, 0x4UL, 0, 0, 0, 0, 0},
+    /*d4*/ {0x80000UL, 0x800UL, 0x8UL, 0, 0, 0, 0, 0},
+    /*e4*/ {0x100000UL, 0x1000UL, 0x10UL, 0, 0, 0, 0, 0},
+    /*f4*/ {0x200000UL, 0x2000UL, 0x20UL, 0, 0, 0, 0, 0},
+    /*g4*/ {0x400000UL, 0x4000UL, 0x40UL, 0, 0, 0, 0, 0},
+    /*h4*/ {0x800000UL, 0x8000UL, 0x80UL, 0, 0, 0, 0, 0},
+    /*a5*/ {0x1000000UL, 0x10000UL, 0x100UL, 0x1UL, 0, 0, 0, 0},
+    /*b5*/ {0x2000000UL, 0x20000UL, 0x200UL, 0x2UL, 0, 0, 0, 0},
+    /*c5*/ {0x4000000UL, 0x40000UL, 0x400UL, 0x4UL, 0, 0, 0, 0},
+    /*d5*/ {0x8000000UL, 0x80000UL, 0x800UL, 0x8UL, 0, 0, 0, 0},
+    /*e5*/ {0x10000000UL, 0x100000UL, 0x1000UL, 0x10UL, 0, 0, 0, 0},
+    /*f5*/ {0x20000000UL, 0x200000UL, 0x2000UL, 0x20UL, 0, 0, 0, 0},
+    /*g5*/ {0x40000000UL, 0x400000UL, 0x4000UL, 0x40UL, 0, 0, 0, 0},
+    /*h5*/ {0x80000000UL, 0x800000UL, 0x8000UL, 0x80UL, 0, 0, 0, 0},
+    /*a6*/ {0x100000000UL, 0x1000000UL, 0x10000UL, 0x100UL, 0x1UL, 0, 0, 0},
+    /*b6*/ {0x200000000UL, 0x2000000UL, 0x20000UL, 0x200UL, 0x2UL, 0, 0, 0},
+    /*c6*/ {0x400000000UL, 0x4000000UL, 0x40000UL, 0x400UL, 0x4UL, 0, 0, 0},
+    /*d6*/ {0x800000000UL, 0x8000000UL, 0x80000UL, 0x800UL, 0x8UL, 0, 0, 0},
+    /*e6*/ {0x1000000000UL, 0x10000000UL, 0x100000UL, 0x1000UL, 0x10UL, 0, 0,
+            0},
+    /*f6*/ {0x2000000000UL, 0x20000000UL, 0x200000UL, 0x2000UL, 0x20UL, 0, 0,
+            0},
+    /*g6*/ {0x4000000000UL, 0x40000000UL, 0x400000UL, 0x4000UL, 0x40UL, 0, 0,
+            0},
+    /*h6*/ {0x8000000000UL, 0x80000000UL, 0x800000UL, 0x8000UL, 0x80UL, 0, 0,
+            0},
+    /*a7*/ {0x10000000000UL, 0x100000000UL, 0x1000000UL, 0x10000UL, 0x100UL,
+            0x1UL, 0, 0},
+    /*b7*/ {0x20000000000UL, 0x200000000UL, 0x2000000UL, 0x20000UL, 0x200UL,
+            0x2UL, 0, 0},
+    /*c7*/ {0x40000000000UL, 0x400000000UL, 0x4000000UL, 0x40000UL, 0x400UL,
+            0x4UL, 0, 0},
+    /*d7*/ {0x80000000000UL, 0x800000000UL, 0x8000000UL, 0x80000UL, 0x800UL,
+            0x8UL, 0, 0},
+    /*e7*/ {0x100000000000UL, 0x1000000000UL, 0x10000000UL, 0x100000UL,
+            0x1000UL, 0x10UL, 0, 0},
+    /*f7*/ {0x200000000000UL, 0x2000000000UL, 0x20000000UL, 0x200000UL,
+            0x2000UL, 0x20UL, 0, 0},
+    /*g7*/ {0x400000000000UL, 0x4000000000UL, 0x40000000UL, 0x400000UL,
+            0x4000UL, 0x40UL, 0, 0},
+    /*h7*/ {0x800000000000UL, 0x8000000000UL, 0x80000000UL, 0x800000UL,
+            0x8000UL, 0x80UL, 0, 0},
+    /*a8*/ {0x1000000000000UL, 0x10000000000UL, 0x100000000UL, 0x1000000UL,
+            0x10000UL, 0x100UL, 0x1UL, 0},
+    /*b8*/ {0x2000000000000UL, 0x20000000000UL, 0x200000000UL, 0x2000000UL,
+            0x20000UL, 0x200UL, 0x2UL, 0},
+    /*c8*/ {0x4000000000000UL, 0x40000000000UL, 0x400000000UL, 0x4000000UL,
+            0x40000UL, 0x400UL, 0x4UL, 0},
+    /*d8*/ {0x8000000000000UL, 0x80000000000UL, 0x800000000UL, 0x8000000UL,
+            0x80000UL, 0x800UL, 0x8UL, 0},
+    /*e8*/ {0x10000000000000UL, 0x100000000000UL, 0x1000000000UL, 0x10000000UL,
+            0x100000UL, 0x1000UL, 0x10UL, 0},
+    /*f8*/ {0x20000000000000UL, 0x200000000000UL, 0x2000000000UL, 0x20000000UL,
+            0x200000UL, 0x2000UL, 0x20UL, 0},
+    /*g8*/ {0x40000000000000UL, 0x400000000000UL, 0x4000000000UL, 0x40000000UL,
+            0x400000UL, 0x4000UL, 0x40UL, 0},
+    /*h8*/ {0x80000000000000UL, 0x800000000000UL, 0x8000000000UL, 0x80000000UL,
+            0x800000UL, 0x8000UL, 0x80UL, 0},
+};
+const uint64_t ROOK_RAY_E[64][8] = {
+    /*a1*/ {0x2UL, 0x4UL, 0x8UL, 0x10UL, 0x20UL, 0x40UL, 0x80UL, 0},
+    /*b1*/ {0x4UL, 0x8UL, 0x10UL, 0x20UL, 0x40UL, 0x80UL, 0, 0},
+    /*c1*/ {0x8UL, 0x10UL, 0x20UL, 0x40UL, 0x80UL, 0, 0, 0},
+    /*d1*/ {0x10UL, 0x20UL, 0x40UL, 0x80UL, 0, 0, 0, 0},
+    /*e1*/ {0x20UL, 0x40UL, 0x80UL, 0, 0, 0, 0, 0},
+    /*f1*/ {0x40UL, 0x80UL, 0, 0, 0, 0, 0, 0},
+    /*g1*/ {0x80UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a2*/ {0x200UL, 0x400UL, 0x800UL, 0x1000UL, 0x2000UL, 0x4000UL, 0x8000UL,
+            0},
+    /*b2*/ {0x400UL, 0x800UL, 0x1000UL, 0x2000UL, 0x4000UL, 0x8000UL, 0, 0},
+    /*c2*/ {0x800UL, 0x1000UL, 0x2000UL, 0x4000UL, 0x8000UL, 0, 0, 0},
+    /*d2*/ {0x1000UL, 0x2000UL, 0x4000UL, 0x8000UL, 0, 0, 0, 0},
+    /*e2*/ {0x2000UL, 0x4000UL, 0x8000UL, 0, 0, 0, 0, 0},
+    /*f2*/ {0x4000UL, 0x8000UL, 0, 0, 0, 0, 0, 0},
+    /*g2*/ {0x8000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h2*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a3*/ {0x20000UL, 0x40000UL, 0x80000UL, 0x100000UL, 0x200000UL, 0x400000UL,
+            0x800000UL, 0},
+    /*b3*/ {0x40000UL, 0x80000UL, 0x100000UL, 0x200000UL, 0x400000UL,
+            0x800000UL, 0, 0},
+    /*c3*/ {0x80000UL, 0x100000UL, 0x200000UL, 0x400000UL, 0x800000UL, 0, 0, 0},
+    /*d3*/ {0x100000UL, 0x200000UL, 0x400000UL, 0x800000UL, 0, 0, 0, 0},
+    /*e3*/ {0x200000UL, 0x400000UL, 0x800000UL, 0, 0, 0, 0, 0},
+    /*f3*/ {0x400000UL, 0x800000UL, 0, 0, 0, 0, 0, 0},
+    /*g3*/ {0x800000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h3*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a4*/ {0x2000000UL, 0x4000000UL, 0x8000000UL, 0x10000000UL, 0x20000000UL,
+            0x40000000UL, 0x80000000UL, 0},
+    /*b4*/ {0x4000000UL, 0x8000000UL, 0x10000000UL, 0x20000000UL, 0x40000000UL,
+            0x80000000UL, 0, 0},
+    /*c4*/ {0x8000000UL, 0x10000000UL, 0x20000000UL, 0x40000000UL, 0x80000000UL,
+            0, 0, 0},
+    /*d4*/ {0x10000000UL, 0x20000000UL, 0x40000000UL, 0x80000000UL, 0, 0, 0, 0},
+    /*e4*/ {0x20000000UL, 0x40000000UL, 0x80000000UL, 0, 0, 0, 0, 0},
+    /*f4*/ {0x40000000UL, 0x80000000UL, 0, 0, 0, 0, 0, 0},
+    /*g4*/ {0x80000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h4*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a5*/ {0x200000000UL, 0x400000000UL, 0x800000000UL, 0x1000000000UL,
+            0x2000000000UL, 0x4000000000UL, 0x8000000000UL, 0},
+    /*b5*/ {0x400000000UL, 0x800000000UL, 0x1000000000UL, 0x2000000000UL,
+            0x4000000000UL, 0x8000000000UL, 0, 0},
+    /*c5*/ {0x800000000UL, 0x1000000000UL, 0x2000000000UL, 0x4000000000UL,
+            0x8000000000UL, 0, 0, 0},
+    /*d5*/ {0x1000000000UL, 0x2000000000UL, 0x4000000000UL, 0x8000000000UL, 0,
+            0, 0, 0},
+    /*e5*/ {0x2000000000UL, 0x4000000000UL, 0x8000000000UL, 0, 0, 0, 0, 0},
+    /*f5*/ {0x4000000000UL, 0x8000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g5*/ {0x8000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h5*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a6*/ {0x20000000000UL, 0x40000000000UL, 0x80000000000UL, 0x100000000000UL,
+            0x200000000000UL, 0x400000000000UL, 0x800000000000UL, 0},
+    /*b6*/ {0x40000000000UL, 0x80000000000UL, 0x100000000000UL,
+            0x200000000000UL, 0x400000000000UL, 0x800000000000UL, 0, 0},
+    /*c6*/ {0x80000000000UL, 0x100000000000UL, 0x200000000000UL,
+            0x400000000000UL, 0x800000000000UL, 0, 0, 0},
+    /*d6*/ {0x100000000000UL, 0x200000000000UL, 0x400000000000UL,
+            0x800000000000UL, 0, 0, 0, 0},
+    /*e6*/ {0x200000000000UL, 0x400000000000UL, 0x800000000000UL, 0, 0, 0, 0,
+            0},
+    /*f6*/ {0x400000000000UL, 0x800000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g6*/ {0x800000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h6*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a7*/ {0x2000000000000UL, 0x4000000000000UL, 0x8000000000000UL,
+            0x10000000000000UL, 0x20000000000000UL, 0x40000000000000UL,
+            0x80000000000000UL, 0},
+    /*b7*/ {0x4000000000000UL, 0x8000000000000UL, 0x10000000000000UL,
+            0x20000000000000UL, 0x40000000000000UL, 0x80000000000000UL, 0, 0},
+    /*c7*/ {0x8000000000000UL, 0x10000000000000UL, 0x20000000000000UL,
+            0x40000000000000UL, 0x80000000000000UL, 0, 0, 0},
+    /*d7*/ {0x10000000000000UL, 0x20000000000000UL, 0x40000000000000UL,
+            0x80000000000000UL, 0, 0, 0, 0},
+    /*e7*/ {0x20000000000000UL, 0x40000000000000UL, 0x80000000000000UL, 0, 0, 0,
+            0, 0},
+    /*f7*/ {0x40000000000000UL, 0x80000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g7*/ {0x80000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h7*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*a8*/ {0x200000000000000UL, 0x400000000000000UL, 0x800000000000000UL,
+            0x1000000000000000UL, 0x2000000000000000UL, 0x4000000000000000UL,
+            0x8000000000000000UL, 0},
+    /*b8*/ {0x400000000000000UL, 0x800000000000000UL, 0x1000000000000000UL,
+            0x2000000000000000UL, 0x4000000000000000UL, 0x8000000000000000UL, 0,
+            0},
+    /*c8*/ {0x800000000000000UL, 0x1000000000000000UL, 0x2000000000000000UL,
+            0x4000000000000000UL, 0x8000000000000000UL, 0, 0, 0},
+    /*d8*/ {0x1000000000000000UL, 0x2000000000000000UL, 0x4000000000000000UL,
+            0x8000000000000000UL, 0, 0, 0, 0},
+    /*e8*/ {0x2000000000000000UL, 0x4000000000000000UL, 0x8000000000000000UL, 0,
+            0, 0, 0, 0},
+    /*f8*/ {0x4000000000000000UL, 0x8000000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*g8*/ {0x8000000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*h8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+};
+const uint64_t ROOK_RAY_W[64][8] = {
+    /*a1*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b1*/ {0x1UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c1*/ {0x2UL, 0x1UL, 0, 0, 0, 0, 0, 0},
+    /*d1*/ {0x4UL, 0x2UL, 0x1UL, 0, 0, 0, 0, 0},
+    /*e1*/ {0x8UL, 0x4UL, 0x2UL, 0x1UL, 0, 0, 0, 0},
+    /*f1*/ {0x10UL, 0x8UL, 0x4UL, 0x2UL, 0x1UL, 0, 0, 0},
+    /*g1*/ {0x20UL, 0x10UL, 0x8UL, 0x4UL, 0x2UL, 0x1UL, 0, 0},
+    /*h1*/ {0x40UL, 0x20UL, 0x10UL, 0x8UL, 0x4UL, 0x2UL, 0x1UL, 0},
+    /*a2*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b2*/ {0x100UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c2*/ {0x200UL, 0x100UL, 0, 0, 0, 0, 0, 0},
+    /*d2*/ {0x400UL, 0x200UL, 0x100UL, 0, 0, 0, 0, 0},
+    /*e2*/ {0x800UL, 0x400UL, 0x200UL, 0x100UL, 0, 0, 0, 0},
+    /*f2*/ {0x1000UL, 0x800UL, 0x400UL, 0x200UL, 0x100UL, 0, 0, 0},
+    /*g2*/ {0x2000UL, 0x1000UL, 0x800UL, 0x400UL, 0x200UL, 0x100UL, 0, 0},
+    /*h2*/ {0x4000UL, 0x2000UL, 0x1000UL, 0x800UL, 0x400UL, 0x200UL, 0x100UL,
+            0},
+    /*a3*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b3*/ {0x10000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c3*/ {0x20000UL, 0x10000UL, 0, 0, 0, 0, 0, 0},
+    /*d3*/ {0x40000UL, 0x20000UL, 0x10000UL, 0, 0, 0, 0, 0},
+    /*e3*/ {0x80000UL, 0x40000UL, 0x20000UL, 0x10000UL, 0, 0, 0, 0},
+    /*f3*/ {0x100000UL, 0x80000UL, 0x40000UL, 0x20000UL, 0x10000UL, 0, 0, 0},
+    /*g3*/ {0x200000UL, 0x100000UL, 0x80000UL, 0x40000UL, 0x20000UL, 0x10000UL,
+            0, 0},
+    /*h3*/ {0x400000UL, 0x200000UL, 0x100000UL, 0x80000UL, 0x40000UL, 0x20000UL,
+            0x10000UL, 0},
+    /*a4*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b4*/ {0x1000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c4*/ {0x2000000UL, 0x1000000UL, 0, 0, 0, 0, 0, 0},
+    /*d4*/ {0x4000000UL, 0x2000000UL, 0x1000000UL, 0, 0, 0, 0, 0},
+    /*e4*/ {0x8000000UL, 0x4000000UL, 0x2000000UL, 0x1000000UL, 0, 0, 0, 0},
+    /*f4*/ {0x10000000UL, 0x8000000UL, 0x4000000UL, 0x2000000UL, 0x1000000UL, 0,
+            0, 0},
+    /*g4*/ {0x20000000UL, 0x10000000UL, 0x8000000UL, 0x4000000UL, 0x2000000UL,
+            0x1000000UL, 0, 0},
+    /*h4*/ {0x40000000UL, 0x20000000UL, 0x10000000UL, 0x8000000UL, 0x4000000UL,
+            0x2000000UL, 0x1000000UL, 0},
+    /*a5*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b5*/ {0x100000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c5*/ {0x200000000UL, 0x100000000UL, 0, 0, 0, 0, 0, 0},
+    /*d5*/ {0x400000000UL, 0x200000000UL, 0x100000000UL, 0, 0, 0, 0, 0},
+    /*e5*/ {0x800000000UL, 0x400000000UL, 0x200000000UL, 0x100000000UL, 0, 0, 0,
+            0},
+    /*f5*/ {0x1000000000UL, 0x800000000UL, 0x400000000UL, 0x200000000UL,
+            0x100000000UL, 0, 0, 0},
+    /*g5*/ {0x2000000000UL, 0x1000000000UL, 0x800000000UL, 0x400000000UL,
+            0x200000000UL, 0x100000000UL, 0, 0},
+    /*h5*/ {0x4000000000UL, 0x2000000000UL, 0x1000000000UL, 0x800000000UL,
+            0x400000000UL, 0x200000000UL, 0x100000000UL, 0},
+    /*a6*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b6*/ {0x10000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c6*/ {0x20000000000UL, 0x10000000000UL, 0, 0, 0, 0, 0, 0},
+    /*d6*/ {0x40000000000UL, 0x20000000000UL, 0x10000000000UL, 0, 0, 0, 0, 0},
+    /*e6*/ {0x80000000000UL, 0x40000000000UL, 0x20000000000UL, 0x10000000000UL,
+            0, 0, 0, 0},
+    /*f6*/ {0x100000000000UL, 0x80000000000UL, 0x40000000000UL, 0x20000000000UL,
+            0x10000000000UL, 0, 0, 0},
+    /*g6*/ {0x200000000000UL, 0x100000000000UL, 0x80000000000UL,
+            0x40000000000UL, 0x20000000000UL, 0x10000000000UL, 0, 0},
+    /*h6*/ {0x400000000000UL, 0x200000000000UL, 0x100000000000UL,
+            0x80000000000UL, 0x40000000000UL, 0x20000000000UL, 0x10000000000UL,
+            0},
+    /*a7*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b7*/ {0x1000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c7*/ {0x2000000000000UL, 0x1000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*d7*/ {0x4000000000000UL, 0x2000000000000UL, 0x1000000000000UL, 0, 0, 0, 0,
+            0},
+    /*e7*/ {0x8000000000000UL, 0x4000000000000UL, 0x2000000000000UL,
+            0x1000000000000UL, 0, 0, 0, 0},
+    /*f7*/ {0x10000000000000UL, 0x8000000000000UL, 0x4000000000000UL,
+            0x2000000000000UL, 0x1000000000000UL, 0, 0, 0},
+    /*g7*/ {0x20000000000000UL, 0x10000000000000UL, 0x8000000000000UL,
+            0x4000000000000UL, 0x2000000000000UL, 0x1000000000000UL, 0, 0},
+    /*h7*/ {0x40000000000000UL, 0x20000000000000UL, 0x10000000000000UL,
+            0x8000000000000UL, 0x4000000000000UL, 0x2000000000000UL,
+            0x1000000000000UL, 0},
+    /*a8*/ {0, 0, 0, 0, 0, 0, 0, 0},
+    /*b8*/ {0x100000000000000UL, 0, 0, 0, 0, 0, 0, 0},
+    /*c8*/ {0x200000000000000UL, 0x100000000000000UL, 0, 0, 0, 0, 0, 0},
+    /*d8*/ {0x400000000000000UL, 0x200000000000000UL, 0x100000000000000UL, 0, 0,
+            0, 0, 0},
+    /*e8*/ {0x800000000000000UL, 0x400000000000000UL, 0x200000000000000UL,
+            0x100000000000000UL, 0, 0, 0, 0},
+    /*f8*/ {0x1000000000000000UL, 0x800000000000000UL, 0x400000000000000UL,
+            0x200000000000000UL, 0x100000000000000UL, 0, 0, 0},
+    /*g8*/ {0x2000000000000000UL, 0x1000000000000000UL, 0x800000000000000UL,
+            0x400000000000000UL, 0x200000000000000UL, 0x100000000000000UL, 0,
+            0},
+    /*h8*/ {0x4000000000000000UL, 0x2000000000000000UL, 0x1000000000000000UL,
+            0x800000000000000UL, 0x400000000000000UL, 0x200000000000000UL,
+            0x100000000000000UL, 0},
+};
+const uint64_t ROOK_MASKS[64] = {
+    /*a1*/ 0x101010101017eUL,
+    /*b1*/ 0x202020202027cUL,
+    /*c1*/ 0x404040404047aUL,
+    /*d1*/ 0x8080808080876UL,
+    /*e1*/ 0x1010101010106eUL,
+    /*f1*/ 0x2020202020205eUL,
+    /*g1*/ 0x4040404040403eUL,
+    /*h1*/ 0x8080808080807eUL,
+    /*a2*/ 0x1010101017e00UL,
+    /*b2*/ 0x2020202027c00UL,
+    /*c2*/ 0x4040404047a00UL,
+    /*d2*/ 0x8080808087600UL,
+    /*e2*/ 0x10101010106e00UL,
+    /*f2*/ 0x20202020205e00UL,
+    /*g2*/ 0x40404040403e00UL,
+    /*h2*/ 0x80808080807e00UL,
+    /*a3*/ 0x10101017e0100UL,
+    /*b3*/ 0x20202027c0200UL,
+    /*c3*/ 0x40404047a0400UL,
+    /*d3*/ 0x8080808760800UL,
+    /*e3*/ 0x101010106e1000UL,
+    /*f3*/ 0x202020205e2000UL,
+    /*g3*/ 0x404040403e4000UL,
+    /*h3*/ 0x808080807e8000UL,
+    /*a4*/ 0x101017e010100UL,
+    /*b4*/ 0x202027c020200UL,
+    /*c4*/ 0x404047a040400UL,
+    /*d4*/ 0x8080876080800UL,
+    /*e4*/ 0x1010106e101000UL,
+    /*f4*/ 0x2020205e202000UL,
+    /*g4*/ 0x4040403e404000UL,
+    /*h4*/ 0x8080807e808000UL,
+    /*a5*/ 0x1017e01010100UL,
+    /*b5*/ 0x2027c02020200UL,
+    /*c5*/ 0x4047a04040400UL,
+    /*d5*/ 0x8087608080800UL,
+    /*e5*/ 0x10106e10101000UL,
+    /*f5*/ 0x20205e20202000UL,
+    /*g5*/ 0x40403e40404000UL,
+    /*h5*/ 0x80807e80808000UL,
+    /*a6*/ 0x17e0101010100UL,
+    /*b6*/ 0x27c0202020200UL,
+    /*c6*/ 0x47a0404040400UL,
+    /*d6*/ 0x8760808080800UL,
+    /*e6*/ 0x106e1010101000UL,
+    /*f6*/ 0x205e2020202000UL,
+    /*g6*/ 0x403e4040404000UL,
+    /*h6*/ 0x807e8080808000UL,
+    /*a7*/ 0x7e010101010100UL,
+    /*b7*/ 0x7c020202020200UL,
+    /*c7*/ 0x7a040404040400UL,
+    /*d7*/ 0x76080808080800UL,
+    /*e7*/ 0x6e101010101000UL,
+    /*f7*/ 0x5e202020202000UL,
+    /*g7*/ 0x3e404040404000UL,
+    /*h7*/ 0x7e808080808000UL,
+    /*a8*/ 0x7e01010101010100UL,
+    /*b8*/ 0x7c02020202020200UL,
+    /*c8*/ 0x7a04040404040400UL,
+    /*d8*/ 0x7608080808080800UL,
+    /*e8*/ 0x6e10101010101000UL,
+    /*f8*/ 0x5e20202020202000UL,
+    /*g8*/ 0x3e40404040404000UL,
+    /*h8*/ 0x7e80808080808000UL,
 };
-const bboard_and_square_t BISHOP_RAY_SE[64][8] = {
-    /*a1*/ {{0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88}},
-    /*b1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a2*/
-    {{0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b2*/
-    {{0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c2*/
-    {{0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d2*/
-    {{0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e2*/
-    {{0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f2*/
-    {{0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g2*/
-    {{0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h2*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a3*/
-    {{0x200UL, 0x11},
-     {0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b3*/
-    {{0x400UL, 0x12},
-     {0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c3*/
-    {{0x800UL, 0x13},
-     {0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d3*/
-    {{0x1000UL, 0x14},
-     {0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e3*/
-    {{0x2000UL, 0x15},
-     {0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f3*/
-    {{0x4000UL, 0x16},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g3*/
-    {{0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h3*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a4*/
-    {{0x20000UL, 0x21},
-     {0x400UL, 0x12},
-     {0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b4*/
-    {{0x40000UL, 0x22},
-     {0x800UL, 0x13},
-     {0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c4*/
-    {{0x80000UL, 0x23},
-     {0x1000UL, 0x14},
-     {0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d4*/
-    {{0x100000UL, 0x24},
-     {0x2000UL, 0x15},
-     {0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e4*/
-    {{0x200000UL, 0x25},
-     {0x4000UL, 0x16},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f4*/
-    {{0x400000UL, 0x26},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g4*/
-    {{0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h4*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a5*/
-    {{0x2000000UL, 0x31},
-     {0x40000UL, 0x22},
-     {0x800UL, 0x13},
-     {0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b5*/
-    {{0x4000000UL, 0x32},
-     {0x80000UL, 0x23},
-     {0x1000UL, 0x14},
-     {0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c5*/
-    {{0x8000000UL, 0x33},
-     {0x100000UL, 0x24},
-     {0x2000UL, 0x15},
-     {0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d5*/
-    {{0x10000000UL, 0x34},
-     {0x200000UL, 0x25},
-     {0x4000UL, 0x16},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e5*/
-    {{0x20000000UL, 0x35},
-     {0x400000UL, 0x26},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f5*/
-    {{0x40000000UL, 0x36},
-     {0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g5*/
-    {{0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h5*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a6*/
-    {{0x200000000UL, 0x41},
-     {0x4000000UL, 0x32},
-     {0x80000UL, 0x23},
-     {0x1000UL, 0x14},
-     {0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b6*/
-    {{0x400000000UL, 0x42},
-     {0x8000000UL, 0x33},
-     {0x100000UL, 0x24},
-     {0x2000UL, 0x15},
-     {0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c6*/
-    {{0x800000000UL, 0x43},
-     {0x10000000UL, 0x34},
-     {0x200000UL, 0x25},
-     {0x4000UL, 0x16},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d6*/
-    {{0x1000000000UL, 0x44},
-     {0x20000000UL, 0x35},
-     {0x400000UL, 0x26},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e6*/
-    {{0x2000000000UL, 0x45},
-     {0x40000000UL, 0x36},
-     {0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f6*/
-    {{0x4000000000UL, 0x46},
-     {0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g6*/
-    {{0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h6*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a7*/
-    {{0x20000000000UL, 0x51},
-     {0x400000000UL, 0x42},
-     {0x8000000UL, 0x33},
-     {0x100000UL, 0x24},
-     {0x2000UL, 0x15},
-     {0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b7*/
-    {{0x40000000000UL, 0x52},
-     {0x800000000UL, 0x43},
-     {0x10000000UL, 0x34},
-     {0x200000UL, 0x25},
-     {0x4000UL, 0x16},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c7*/
-    {{0x80000000000UL, 0x53},
-     {0x1000000000UL, 0x44},
-     {0x20000000UL, 0x35},
-     {0x400000UL, 0x26},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d7*/
-    {{0x100000000000UL, 0x54},
-     {0x2000000000UL, 0x45},
-     {0x40000000UL, 0x36},
-     {0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e7*/
-    {{0x200000000000UL, 0x55},
-     {0x4000000000UL, 0x46},
-     {0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f7*/
-    {{0x400000000000UL, 0x56},
-     {0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g7*/
-    {{0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h7*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a8*/
-    {{0x2000000000000UL, 0x61},
-     {0x40000000000UL, 0x52},
-     {0x800000000UL, 0x43},
-     {0x10000000UL, 0x34},
-     {0x200000UL, 0x25},
-     {0x4000UL, 0x16},
-     {0x80UL, 0x7},
-     {0, 0x88}},
-    /*b8*/
-    {{0x4000000000000UL, 0x62},
-     {0x80000000000UL, 0x53},
-     {0x1000000000UL, 0x44},
-     {0x20000000UL, 0x35},
-     {0x400000UL, 0x26},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c8*/
-    {{0x8000000000000UL, 0x63},
-     {0x100000000000UL, 0x54},
-     {0x2000000000UL, 0x45},
-     {0x40000000UL, 0x36},
-     {0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d8*/
-    {{0x10000000000000UL, 0x64},
-     {0x200000000000UL, 0x55},
-     {0x4000000000UL, 0x46},
-     {0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e8*/
-    {{0x20000000000000UL, 0x65},
-     {0x400000000000UL, 0x56},
-     {0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f8*/
-    {{0x40000000000000UL, 0x66},
-     {0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g8*/
-    {{0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
+const uint64_t ROOK_MAGICS[64] = {
+    /*a1*/ 0x80004000208010UL,
+    /*b1*/ 0x840002000100042UL,
+    /*c1*/ 0x20020400a008010UL,
+    /*d1*/ 0x280100080080004UL,
+    /*e1*/ 0x4080028004000800UL,
+    /*f1*/ 0x280040002008001UL,
+    /*g1*/ 0x40010080c064181UL,
+    /*h1*/ 0x200004100249204UL,
+    /*a2*/ 0x20a08000400c2280UL,
+    /*b2*/ 0x43402000401005UL,
+    /*c2*/ 0x600802000801000UL,
+    /*d2*/ 0x4600210a004010UL,
+    /*e2*/ 0x4000800800800400UL,
+    /*f2*/ 0x2010800200800400UL,
+    /*g2*/ 0x9000100040200UL,
+    /*h2*/ 0x1801000641002192UL,
+    /*a3*/ 0x440148004842040UL,
+    /*b3*/ 0x2600808020004000UL,
+    /*c3*/ 0x4010002004080020UL,
+    /*d3*/ 0x20004200100a0020UL,
+    /*e3*/ 0x808808004000800UL,
+    /*f3*/ 0x100808002000400UL,
+    /*g3*/ 0x4004840010021128UL,
+    /*h3*/ 0x800a0000810054UL,
+    /*a4*/ 0x40c0008080004020UL,
+    /*b4*/ 0x4000200080400081UL,
+    /*c4*/ 0x8141004500152000UL,
+    /*d4*/ 0x12012012000a4200UL,
+    /*e4*/ 0x18008080080400UL,
+    /*f4*/ 0x4802000404001020UL,
+    /*g4*/ 0x4880420400480110UL,
+    /*h4*/ 0x4004104200140081UL,
+    /*a5*/ 0x804002800026UL,
+    /*b5*/ 0x5010804008802000UL,
+    /*c5*/ 0x20050241001020UL,
+    /*d5*/ 0x8801000800800UL,
+    /*e5*/ 0x8005000801000410UL,
+    /*f5*/ 0x208200408011040UL,
+    /*g5*/ 0x80104000210UL,
+    /*h5*/ 0x2010240042001081UL,
+    /*a6*/ 0xb04718440018000UL,
+    /*b6*/ 0x1110004020024000UL,
+    /*c6*/ 0x480402001010010UL,
+    /*d6*/ 0x8001011004090020UL,
+    /*e6*/ 0x4000040801010010UL,
+    /*f6*/ 0x802001020040400UL,
+    /*g6*/ 0x10480102040050UL,
+    /*h6*/ 0x1010549d020004UL,
+    /*a7*/ 0x2300402081020200UL,
+    /*b7*/ 0x2010400060100940UL,
+    /*c7*/ 0x42001020804200UL,
+    /*d7*/ 0x80010008080UL,
+    /*e7*/ 0x410101801012d00UL,
+    /*f7*/ 0x3081000804000300UL,
+    /*g7*/ 0x4000482102100400UL,
+    /*h7*/ 0x80040110408200UL,
+    /*a8*/ 0x104820800101UL,
+    /*b8*/ 0x2030810200401022UL,
+    /*c8*/ 0x2004010200882UL,
+    /*d8*/ 0x1a30200900041001UL,
+    /*e8*/ 0x201005800100215UL,
+    /*f8*/ 0x400200b021040802UL,
+    /*g8*/ 0x80401a8801023044UL,
+    /*h8*/ 0x5080210402UL,
 };
-const bboard_and_square_t BISHOP_RAY_NW[64][8] = {
-    /*a1*/ {{0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88}},
-    /*b1*/
-    {{0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c1*/
-    {{0x200UL, 0x11},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d1*/
-    {{0x400UL, 0x12},
-     {0x20000UL, 0x21},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e1*/
-    {{0x800UL, 0x13},
-     {0x40000UL, 0x22},
-     {0x2000000UL, 0x31},
-     {0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f1*/
-    {{0x1000UL, 0x14},
-     {0x80000UL, 0x23},
-     {0x4000000UL, 0x32},
-     {0x200000000UL, 0x41},
-     {0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g1*/
-    {{0x2000UL, 0x15},
-     {0x100000UL, 0x24},
-     {0x8000000UL, 0x33},
-     {0x400000000UL, 0x42},
-     {0x20000000000UL, 0x51},
-     {0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h1*/
-    {{0x4000UL, 0x16},
-     {0x200000UL, 0x25},
-     {0x10000000UL, 0x34},
-     {0x800000000UL, 0x43},
-     {0x40000000000UL, 0x52},
-     {0x2000000000000UL, 0x61},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88}},
-    /*a2*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b2*/
-    {{0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c2*/
-    {{0x20000UL, 0x21},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d2*/
-    {{0x40000UL, 0x22},
-     {0x2000000UL, 0x31},
-     {0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e2*/
-    {{0x80000UL, 0x23},
-     {0x4000000UL, 0x32},
-     {0x200000000UL, 0x41},
-     {0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f2*/
-    {{0x100000UL, 0x24},
-     {0x8000000UL, 0x33},
-     {0x400000000UL, 0x42},
-     {0x20000000000UL, 0x51},
-     {0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g2*/
-    {{0x200000UL, 0x25},
-     {0x10000000UL, 0x34},
-     {0x800000000UL, 0x43},
-     {0x40000000000UL, 0x52},
-     {0x2000000000000UL, 0x61},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h2*/
-    {{0x400000UL, 0x26},
-     {0x20000000UL, 0x35},
-     {0x1000000000UL, 0x44},
-     {0x80000000000UL, 0x53},
-     {0x4000000000000UL, 0x62},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a3*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b3*/
-    {{0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c3*/
-    {{0x2000000UL, 0x31},
-     {0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d3*/
-    {{0x4000000UL, 0x32},
-     {0x200000000UL, 0x41},
-     {0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e3*/
-    {{0x8000000UL, 0x33},
-     {0x400000000UL, 0x42},
-     {0x20000000000UL, 0x51},
-     {0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f3*/
-    {{0x10000000UL, 0x34},
-     {0x800000000UL, 0x43},
-     {0x40000000000UL, 0x52},
-     {0x2000000000000UL, 0x61},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g3*/
-    {{0x20000000UL, 0x35},
-     {0x1000000000UL, 0x44},
-     {0x80000000000UL, 0x53},
-     {0x4000000000000UL, 0x62},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h3*/
-    {{0x40000000UL, 0x36},
-     {0x2000000000UL, 0x45},
-     {0x100000000000UL, 0x54},
-     {0x8000000000000UL, 0x63},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a4*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b4*/
-    {{0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c4*/
-    {{0x200000000UL, 0x41},
-     {0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d4*/
-    {{0x400000000UL, 0x42},
-     {0x20000000000UL, 0x51},
-     {0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e4*/
-    {{0x800000000UL, 0x43},
-     {0x40000000000UL, 0x52},
-     {0x2000000000000UL, 0x61},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f4*/
-    {{0x1000000000UL, 0x44},
-     {0x80000000000UL, 0x53},
-     {0x4000000000000UL, 0x62},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g4*/
-    {{0x2000000000UL, 0x45},
-     {0x100000000000UL, 0x54},
-     {0x8000000000000UL, 0x63},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h4*/
-    {{0x4000000000UL, 0x46},
-     {0x200000000000UL, 0x55},
-     {0x10000000000000UL, 0x64},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a5*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b5*/
-    {{0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c5*/
-    {{0x20000000000UL, 0x51},
-     {0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d5*/
-    {{0x40000000000UL, 0x52},
-     {0x2000000000000UL, 0x61},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e5*/
-    {{0x80000000000UL, 0x53},
-     {0x4000000000000UL, 0x62},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f5*/
-    {{0x100000000000UL, 0x54},
-     {0x8000000000000UL, 0x63},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g5*/
-    {{0x200000000000UL, 0x55},
-     {0x10000000000000UL, 0x64},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h5*/
-    {{0x400000000000UL, 0x56},
-     {0x20000000000000UL, 0x65},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a6*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b6*/
-    {{0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c6*/
-    {{0x2000000000000UL, 0x61},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d6*/
-    {{0x4000000000000UL, 0x62},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e6*/
-    {{0x8000000000000UL, 0x63},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f6*/
-    {{0x10000000000000UL, 0x64},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g6*/
-    {{0x20000000000000UL, 0x65},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h6*/
-    {{0x40000000000000UL, 0x66},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a7*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b7*/
-    {{0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c7*/
-    {{0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d7*/
-    {{0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e7*/
-    {{0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f7*/
-    {{0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g7*/
-    {{0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h7*/
-    {{0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
+const uint8_t ROOK_SHIFTS[64] = {
+    /*a1*/ 52,
+    /*b1*/ 53,
+    /*c1*/ 53,
+    /*d1*/ 53,
+    /*e1*/ 53,
+    /*f1*/ 53,
+    /*g1*/ 53,
+    /*h1*/ 52,
+    /*a2*/ 53,
+    /*b2*/ 54,
+    /*c2*/ 54,
+    /*d2*/ 54,
+    /*e2*/ 54,
+    /*f2*/ 54,
+    /*g2*/ 54,
+    /*h2*/ 53,
+    /*a3*/ 53,
+    /*b3*/ 54,
+    /*c3*/ 54,
+    /*d3*/ 54,
+    /*e3*/ 54,
+    /*f3*/ 54,
+    /*g3*/ 54,
+    /*h3*/ 53,
+    /*a4*/ 53,
+    /*b4*/ 54,
+    /*c4*/ 54,
+    /*d4*/ 54,
+    /*e4*/ 54,
+    /*f4*/ 54,
+    /*g4*/ 54,
+    /*h4*/ 53,
+    /*a5*/ 53,
+    /*b5*/ 54,
+    /*c5*/ 54,
+    /*d5*/ 54,
+    /*e5*/ 54,
+    /*f5*/ 54,
+    /*g5*/ 54,
+    /*h5*/ 53,
+    /*a6*/ 53,
+    /*b6*/ 54,
+    /*c6*/ 54,
+    /*d6*/ 54,
+    /*e6*/ 54,
+    /*f6*/ 54,
+    /*g6*/ 54,
+    /*h6*/ 53,
+    /*a7*/ 53,
+    /*b7*/ 54,
+    /*c7*/ 54,
+    /*d7*/ 54,
+    /*e7*/ 54,
+    /*f7*/ 54,
+    /*g7*/ 54,
+    /*h7*/ 53,
+    /*a8*/ 52,
+    /*b8*/ 53,
+    /*c8*/ 53,
+    /*d8*/ 53,
+    /*e8*/ 53,
+    /*f8*/ 53,
+    /*g8*/ 53,
+    /*h8*/ 52,
 };
-const bboard_and_square_t BISHOP_RAY_SW[64][8] = {
-    /*a1*/ {{0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88}},
-    /*b1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a2*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b2*/
-    {{0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c2*/
-    {{0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d2*/
-    {{0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e2*/
-    {{0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f2*/
-    {{0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g2*/
-    {{0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h2*/
-    {{0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a3*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b3*/
-    {{0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c3*/
-    {{0x200UL, 0x11},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d3*/
-    {{0x400UL, 0x12},
-     {0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e3*/
-    {{0x800UL, 0x13},
-     {0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f3*/
-    {{0x1000UL, 0x14},
-     {0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g3*/
-    {{0x2000UL, 0x15},
-     {0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h3*/
-    {{0x4000UL, 0x16},
-     {0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a4*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b4*/
-    {{0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c4*/
-    {{0x20000UL, 0x21},
-     {0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d4*/
-    {{0x40000UL, 0x22},
-     {0x200UL, 0x11},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e4*/
-    {{0x80000UL, 0x23},
-     {0x400UL, 0x12},
-     {0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f4*/
-    {{0x100000UL, 0x24},
-     {0x800UL, 0x13},
-     {0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g4*/
-    {{0x200000UL, 0x25},
-     {0x1000UL, 0x14},
-     {0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h4*/
-    {{0x400000UL, 0x26},
-     {0x2000UL, 0x15},
-     {0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a5*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b5*/
-    {{0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c5*/
-    {{0x2000000UL, 0x31},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d5*/
-    {{0x4000000UL, 0x32},
-     {0x20000UL, 0x21},
-     {0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e5*/
-    {{0x8000000UL, 0x33},
-     {0x40000UL, 0x22},
-     {0x200UL, 0x11},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f5*/
-    {{0x10000000UL, 0x34},
-     {0x80000UL, 0x23},
-     {0x400UL, 0x12},
-     {0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g5*/
-    {{0x20000000UL, 0x35},
-     {0x100000UL, 0x24},
-     {0x800UL, 0x13},
-     {0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h5*/
-    {{0x40000000UL, 0x36},
-     {0x200000UL, 0x25},
-     {0x1000UL, 0x14},
-     {0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a6*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b6*/
-    {{0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c6*/
-    {{0x200000000UL, 0x41},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d6*/
-    {{0x400000000UL, 0x42},
-     {0x2000000UL, 0x31},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e6*/
-    {{0x800000000UL, 0x43},
-     {0x4000000UL, 0x32},
-     {0x20000UL, 0x21},
-     {0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f6*/
-    {{0x1000000000UL, 0x44},
-     {0x8000000UL, 0x33},
-     {0x40000UL, 0x22},
-     {0x200UL, 0x11},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g6*/
-    {{0x2000000000UL, 0x45},
-     {0x10000000UL, 0x34},
-     {0x80000UL, 0x23},
-     {0x400UL, 0x12},
-     {0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h6*/
-    {{0x4000000000UL, 0x46},
-     {0x20000000UL, 0x35},
-     {0x100000UL, 0x24},
-     {0x800UL, 0x13},
-     {0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a7*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b7*/
-    {{0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c7*/
-    {{0x20000000000UL, 0x51},
-     {0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d7*/
-    {{0x40000000000UL, 0x52},
-     {0x200000000UL, 0x41},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e7*/
-    {{0x80000000000UL, 0x53},
-     {0x400000000UL, 0x42},
-     {0x2000000UL, 0x31},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f7*/
-    {{0x100000000000UL, 0x54},
-     {0x800000000UL, 0x43},
-     {0x4000000UL, 0x32},
-     {0x20000UL, 0x21},
-     {0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g7*/
-    {{0x200000000000UL, 0x55},
-     {0x1000000000UL, 0x44},
-     {0x8000000UL, 0x33},
-     {0x40000UL, 0x22},
-     {0x200UL, 0x11},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h7*/
-    {{0x400000000000UL, 0x56},
-     {0x2000000000UL, 0x45},
-     {0x10000000UL, 0x34},
-     {0x80000UL, 0x23},
-     {0x400UL, 0x12},
-     {0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b8*/
-    {{0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c8*/
-    {{0x2000000000000UL, 0x61},
-     {0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d8*/
-    {{0x4000000000000UL, 0x62},
-     {0x20000000000UL, 0x51},
-     {0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e8*/
-    {{0x8000000000000UL, 0x63},
-     {0x40000000000UL, 0x52},
-     {0x200000000UL, 0x41},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f8*/
-    {{0x10000000000000UL, 0x64},
-     {0x80000000000UL, 0x53},
-     {0x400000000UL, 0x42},
-     {0x2000000UL, 0x31},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g8*/
-    {{0x20000000000000UL, 0x65},
-     {0x100000000000UL, 0x54},
-     {0x800000000UL, 0x43},
-     {0x4000000UL, 0x32},
-     {0x20000UL, 0x21},
-     {0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h8*/
-    {{0x40000000000000UL, 0x66},
-     {0x200000000000UL, 0x55},
-     {0x1000000000UL, 0x44},
-     {0x8000000UL, 0x33},
-     {0x40000UL, 0x22},
-     {0x200UL, 0x11},
-     {0x1UL, 0x0},
-     {0, 0x88}},
+const uint32_t ROOK_OFFSETS[64] = {
+    /*a1*/ 0,
+    /*b1*/ 4096,
+    /*c1*/ 6144,
+    /*d1*/ 8192,
+    /*e1*/ 10240,
+    /*f1*/ 12288,
+    /*g1*/ 14336,
+    /*h1*/ 16384,
+    /*a2*/ 20480,
+    /*b2*/ 22528,
+    /*c2*/ 23552,
+    /*d2*/ 24576,
+    /*e2*/ 25600,
+    /*f2*/ 26624,
+    /*g2*/ 27648,
+    /*h2*/ 28672,
+    /*a3*/ 30720,
+    /*b3*/ 32768,
+    /*c3*/ 33792,
+    /*d3*/ 34816,
+    /*e3*/ 35840,
+    /*f3*/ 36864,
+    /*g3*/ 37888,
+    /*h3*/ 38912,
+    /*a4*/ 40960,
+    /*b4*/ 43008,
+    /*c4*/ 44032,
+    /*d4*/ 45056,
+    /*e4*/ 46080,
+    /*f4*/ 47104,
+    /*g4*/ 48128,
+    /*h4*/ 49152,
+    /*a5*/ 51200,
+    /*b5*/ 53248,
+    /*c5*/ 54272,
+    /*d5*/ 55296,
+    /*e5*/ 56320,
+    /*f5*/ 57344,
+    /*g5*/ 58368,
+    /*h5*/ 59392,
+    /*a6*/ 61440,
+    /*b6*/ 63488,
+    /*c6*/ 64512,
+    /*d6*/ 65536,
+    /*e6*/ 66560,
+    /*f6*/ 67584,
+    /*g6*/ 68608,
+    /*h6*/ 69632,
+    /*a7*/ 71680,
+    /*b7*/ 73728,
+    /*c7*/ 74752,
+    /*d7*/ 75776,
+    /*e7*/ 76800,
+    /*f7*/ 77824,
+    /*g7*/ 78848,
+    /*h7*/ 79872,
+    /*a8*/ 81920,
+    /*b8*/ 86016,
+    /*c8*/ 88064,
+    /*d8*/ 90112,
+    /*e8*/ 92160,
+    /*f8*/ 94208,
+    /*g8*/ 96256,
+    /*h8*/ 98304,
 };
-const bboard_and_square_t ROOK_RAY_N[64][8] = {
-    /*a1*/ {{0x100UL, 0x10},
-            {0x10000UL, 0x20},
-            {0x1000000UL, 0x30},
-            {0x100000000UL, 0x40},
-            {0x10000000000UL, 0x50},
-            {0x1000000000000UL, 0x60},
-            {0x100000000000000UL, 0x70},
-            {0, 0x88}},
-    /*b1*/
-    {{0x200UL, 0x11},
-     {0x20000UL, 0x21},
-     {0x2000000UL, 0x31},
-     {0x200000000UL, 0x41},
-     {0x20000000000UL, 0x51},
-     {0x2000000000000UL, 0x61},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88}},
-    /*c1*/
-    {{0x400UL, 0x12},
-     {0x40000UL, 0x22},
-     {0x4000000UL, 0x32},
-     {0x400000000UL, 0x42},
-     {0x40000000000UL, 0x52},
-     {0x4000000000000UL, 0x62},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88}},
-    /*d1*/
-    {{0x800UL, 0x13},
-     {0x80000UL, 0x23},
-     {0x8000000UL, 0x33},
-     {0x800000000UL, 0x43},
-     {0x80000000000UL, 0x53},
-     {0x8000000000000UL, 0x63},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88}},
-    /*e1*/
-    {{0x1000UL, 0x14},
-     {0x100000UL, 0x24},
-     {0x10000000UL, 0x34},
-     {0x1000000000UL, 0x44},
-     {0x100000000000UL, 0x54},
-     {0x10000000000000UL, 0x64},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88}},
-    /*f1*/
-    {{0x2000UL, 0x15},
-     {0x200000UL, 0x25},
-     {0x20000000UL, 0x35},
-     {0x2000000000UL, 0x45},
-     {0x200000000000UL, 0x55},
-     {0x20000000000000UL, 0x65},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88}},
-    /*g1*/
-    {{0x4000UL, 0x16},
-     {0x400000UL, 0x26},
-     {0x40000000UL, 0x36},
-     {0x4000000000UL, 0x46},
-     {0x400000000000UL, 0x56},
-     {0x40000000000000UL, 0x66},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88}},
-    /*h1*/
-    {{0x8000UL, 0x17},
-     {0x800000UL, 0x27},
-     {0x80000000UL, 0x37},
-     {0x8000000000UL, 0x47},
-     {0x800000000000UL, 0x57},
-     {0x80000000000000UL, 0x67},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88}},
-    /*a2*/
-    {{0x10000UL, 0x20},
-     {0x1000000UL, 0x30},
-     {0x100000000UL, 0x40},
-     {0x10000000000UL, 0x50},
-     {0x1000000000000UL, 0x60},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b2*/
-    {{0x20000UL, 0x21},
-     {0x2000000UL, 0x31},
-     {0x200000000UL, 0x41},
-     {0x20000000000UL, 0x51},
-     {0x2000000000000UL, 0x61},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c2*/
-    {{0x40000UL, 0x22},
-     {0x4000000UL, 0x32},
-     {0x400000000UL, 0x42},
-     {0x40000000000UL, 0x52},
-     {0x4000000000000UL, 0x62},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d2*/
-    {{0x80000UL, 0x23},
-     {0x8000000UL, 0x33},
-     {0x800000000UL, 0x43},
-     {0x80000000000UL, 0x53},
-     {0x8000000000000UL, 0x63},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e2*/
-    {{0x100000UL, 0x24},
-     {0x10000000UL, 0x34},
-     {0x1000000000UL, 0x44},
-     {0x100000000000UL, 0x54},
-     {0x10000000000000UL, 0x64},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f2*/
-    {{0x200000UL, 0x25},
-     {0x20000000UL, 0x35},
-     {0x2000000000UL, 0x45},
-     {0x200000000000UL, 0x55},
-     {0x20000000000000UL, 0x65},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g2*/
-    {{0x400000UL, 0x26},
-     {0x40000000UL, 0x36},
-     {0x4000000000UL, 0x46},
-     {0x400000000000UL, 0x56},
-     {0x40000000000000UL, 0x66},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h2*/
-    {{0x800000UL, 0x27},
-     {0x80000000UL, 0x37},
-     {0x8000000000UL, 0x47},
-     {0x800000000000UL, 0x57},
-     {0x80000000000000UL, 0x67},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a3*/
-    {{0x1000000UL, 0x30},
-     {0x100000000UL, 0x40},
-     {0x10000000000UL, 0x50},
-     {0x1000000000000UL, 0x60},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b3*/
-    {{0x2000000UL, 0x31},
-     {0x200000000UL, 0x41},
-     {0x20000000000UL, 0x51},
-     {0x2000000000000UL, 0x61},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c3*/
-    {{0x4000000UL, 0x32},
-     {0x400000000UL, 0x42},
-     {0x40000000000UL, 0x52},
-     {0x4000000000000UL, 0x62},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d3*/
-    {{0x8000000UL, 0x33},
-     {0x800000000UL, 0x43},
-     {0x80000000000UL, 0x53},
-     {0x8000000000000UL, 0x63},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e3*/
-    {{0x10000000UL, 0x34},
-     {0x1000000000UL, 0x44},
-     {0x100000000000UL, 0x54},
-     {0x10000000000000UL, 0x64},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f3*/
-    {{0x20000000UL, 0x35},
-     {0x2000000000UL, 0x45},
-     {0x200000000000UL, 0x55},
-     {0x20000000000000UL, 0x65},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g3*/
-    {{0x40000000UL, 0x36},
-     {0x4000000000UL, 0x46},
-     {0x400000000000UL, 0x56},
-     {0x40000000000000UL, 0x66},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h3*/
-    {{0x80000000UL, 0x37},
-     {0x8000000000UL, 0x47},
-     {0x800000000000UL, 0x57},
-     {0x80000000000000UL, 0x67},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a4*/
-    {{0x100000000UL, 0x40},
-     {0x10000000000UL, 0x50},
-     {0x1000000000000UL, 0x60},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b4*/
-    {{0x200000000UL, 0x41},
-     {0x20000000000UL, 0x51},
-     {0x2000000000000UL, 0x61},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c4*/
-    {{0x400000000UL, 0x42},
-     {0x40000000000UL, 0x52},
-     {0x4000000000000UL, 0x62},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d4*/
-    {{0x800000000UL, 0x43},
-     {0x80000000000UL, 0x53},
-     {0x8000000000000UL, 0x63},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e4*/
-    {{0x1000000000UL, 0x44},
-     {0x100000000000UL, 0x54},
-     {0x10000000000000UL, 0x64},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f4*/
-    {{0x2000000000UL, 0x45},
-     {0x200000000000UL, 0x55},
-     {0x20000000000000UL, 0x65},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g4*/
-    {{0x4000000000UL, 0x46},
-     {0x400000000000UL, 0x56},
-     {0x40000000000000UL, 0x66},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h4*/
-    {{0x8000000000UL, 0x47},
-     {0x800000000000UL, 0x57},
-     {0x80000000000000UL, 0x67},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a5*/
-    {{0x10000000000UL, 0x50},
-     {0x1000000000000UL, 0x60},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b5*/
-    {{0x20000000000UL, 0x51},
-     {0x2000000000000UL, 0x61},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c5*/
-    {{0x40000000000UL, 0x52},
-     {0x4000000000000UL, 0x62},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d5*/
-    {{0x80000000000UL, 0x53},
-     {0x8000000000000UL, 0x63},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e5*/
-    {{0x100000000000UL, 0x54},
-     {0x10000000000000UL, 0x64},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f5*/
-    {{0x200000000000UL, 0x55},
-     {0x20000000000000UL, 0x65},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g5*/
-    {{0x400000000000UL, 0x56},
-     {0x40000000000000UL, 0x66},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h5*/
-    {{0x800000000000UL, 0x57},
-     {0x80000000000000UL, 0x67},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a6*/
-    {{0x1000000000000UL, 0x60},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b6*/
-    {{0x2000000000000UL, 0x61},
-     {0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c6*/
-    {{0x4000000000000UL, 0x62},
-     {0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d6*/
-    {{0x8000000000000UL, 0x63},
-     {0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e6*/
-    {{0x10000000000000UL, 0x64},
-     {0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f6*/
-    {{0x20000000000000UL, 0x65},
-     {0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g6*/
-    {{0x40000000000000UL, 0x66},
-     {0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h6*/
-    {{0x80000000000000UL, 0x67},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a7*/
-    {{0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b7*/
-    {{0x200000000000000UL, 0x71},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c7*/
-    {{0x400000000000000UL, 0x72},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d7*/
-    {{0x800000000000000UL, 0x73},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e7*/
-    {{0x1000000000000000UL, 0x74},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f7*/
-    {{0x2000000000000000UL, 0x75},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g7*/
-    {{0x4000000000000000UL, 0x76},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h7*/
-    {{0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
+const uint64_t BISHOP_MASKS[64] = {
+    /*a1*/ 0x40201008040200UL,
+    /*b1*/ 0x402010080400UL,
+    /*c1*/ 0x4020100a00UL,
+    /*d1*/ 0x40221400UL,
+    /*e1*/ 0x2442800UL,
+    /*f1*/ 0x204085000UL,
+    /*g1*/ 0x20408102000UL,
+    /*h1*/ 0x2040810204000UL,
+    /*a2*/ 0x20100804020000UL,
+    /*b2*/ 0x40201008040000UL,
+    /*c2*/ 0x4020100a0000UL,
+    /*d2*/ 0x4022140000UL,
+    /*e2*/ 0x244280000UL,
+    /*f2*/ 0x20408500000UL,
+    /*g2*/ 0x2040810200000UL,
+    /*h2*/ 0x4081020400000UL,
+    /*a3*/ 0x10080402000200UL,
+    /*b3*/ 0x20100804000400UL,
+    /*c3*/ 0x4020100a000a00UL,
+    /*d3*/ 0x402214001400UL,
+    /*e3*/ 0x24428002800UL,
+    /*f3*/ 0x2040850005000UL,
+    /*g3*/ 0x4081020002000UL,
+    /*h3*/ 0x8102040004000UL,
+    /*a4*/ 0x8040200020400UL,
+    /*b4*/ 0x10080400040800UL,
+    /*c4*/ 0x20100a000a1000UL,
+    /*d4*/ 0x40221400142200UL,
+    /*e4*/ 0x2442800284400UL,
+    /*f4*/ 0x4085000500800UL,
+    /*g4*/ 0x8102000201000UL,
+    /*h4*/ 0x10204000402000UL,
+    /*a5*/ 0x4020002040800UL,
+    /*b5*/ 0x8040004081000UL,
+    /*c5*/ 0x100a000a102000UL,
+    /*d5*/ 0x22140014224000UL,
+    /*e5*/ 0x44280028440200UL,
+    /*f5*/ 0x8500050080400UL,
+    /*g5*/ 0x10200020100800UL,
+    /*h5*/ 0x20400040201000UL,
+    /*a6*/ 0x2000204081000UL,
+    /*b6*/ 0x4000408102000UL,
+    /*c6*/ 0xa000a10204000UL,
+    /*d6*/ 0x14001422400000UL,
+    /*e6*/ 0x28002844020000UL,
+    /*f6*/ 0x50005008040200UL,
+    /*g6*/ 0x20002010080400UL,
+    /*h6*/ 0x40004020100800UL,
+    /*a7*/ 0x20408102000UL,
+    /*b7*/ 0x40810204000UL,
+    /*c7*/ 0xa1020400000UL,
+    /*d7*/ 0x142240000000UL,
+    /*e7*/ 0x284402000000UL,
+    /*f7*/ 0x500804020000UL,
+    /*g7*/ 0x201008040200UL,
+    /*h7*/ 0x402010080400UL,
+    /*a8*/ 0x2040810204000UL,
+    /*b8*/ 0x4081020400000UL,
+    /*c8*/ 0xa102040000000UL,
+    /*d8*/ 0x14224000000000UL,
+    /*e8*/ 0x28440200000000UL,
+    /*f8*/ 0x50080402000000UL,
+    /*g8*/ 0x20100804020000UL,
+    /*h8*/ 0x40201008040200UL,
 };
-const bboard_and_square_t ROOK_RAY_S[64][8] = {
-    /*a1*/ {{0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88}},
-    /*b1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a2*/
-    {{0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b2*/
-    {{0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c2*/
-    {{0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d2*/
-    {{0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e2*/
-    {{0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f2*/
-    {{0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g2*/
-    {{0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h2*/
-    {{0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a3*/
-    {{0x100UL, 0x10},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b3*/
-    {{0x200UL, 0x11},
-     {0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c3*/
-    {{0x400UL, 0x12},
-     {0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d3*/
-    {{0x800UL, 0x13},
-     {0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e3*/
-    {{0x1000UL, 0x14},
-     {0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f3*/
-    {{0x2000UL, 0x15},
-     {0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g3*/
-    {{0x4000UL, 0x16},
-     {0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h3*/
-    {{0x8000UL, 0x17},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a4*/
-    {{0x10000UL, 0x20},
-     {0x100UL, 0x10},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b4*/
-    {{0x20000UL, 0x21},
-     {0x200UL, 0x11},
-     {0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c4*/
-    {{0x40000UL, 0x22},
-     {0x400UL, 0x12},
-     {0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d4*/
-    {{0x80000UL, 0x23},
-     {0x800UL, 0x13},
-     {0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e4*/
-    {{0x100000UL, 0x24},
-     {0x1000UL, 0x14},
-     {0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f4*/
-    {{0x200000UL, 0x25},
-     {0x2000UL, 0x15},
-     {0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g4*/
-    {{0x400000UL, 0x26},
-     {0x4000UL, 0x16},
-     {0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h4*/
-    {{0x800000UL, 0x27},
-     {0x8000UL, 0x17},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a5*/
-    {{0x1000000UL, 0x30},
-     {0x10000UL, 0x20},
-     {0x100UL, 0x10},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b5*/
-    {{0x2000000UL, 0x31},
-     {0x20000UL, 0x21},
-     {0x200UL, 0x11},
-     {0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c5*/
-    {{0x4000000UL, 0x32},
-     {0x40000UL, 0x22},
-     {0x400UL, 0x12},
-     {0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d5*/
-    {{0x8000000UL, 0x33},
-     {0x80000UL, 0x23},
-     {0x800UL, 0x13},
-     {0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e5*/
-    {{0x10000000UL, 0x34},
-     {0x100000UL, 0x24},
-     {0x1000UL, 0x14},
-     {0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f5*/
-    {{0x20000000UL, 0x35},
-     {0x200000UL, 0x25},
-     {0x2000UL, 0x15},
-     {0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g5*/
-    {{0x40000000UL, 0x36},
-     {0x400000UL, 0x26},
-     {0x4000UL, 0x16},
-     {0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h5*/
-    {{0x80000000UL, 0x37},
-     {0x800000UL, 0x27},
-     {0x8000UL, 0x17},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a6*/
-    {{0x100000000UL, 0x40},
-     {0x1000000UL, 0x30},
-     {0x10000UL, 0x20},
-     {0x100UL, 0x10},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b6*/
-    {{0x200000000UL, 0x41},
-     {0x2000000UL, 0x31},
-     {0x20000UL, 0x21},
-     {0x200UL, 0x11},
-     {0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c6*/
-    {{0x400000000UL, 0x42},
-     {0x4000000UL, 0x32},
-     {0x40000UL, 0x22},
-     {0x400UL, 0x12},
-     {0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d6*/
-    {{0x800000000UL, 0x43},
-     {0x8000000UL, 0x33},
-     {0x80000UL, 0x23},
-     {0x800UL, 0x13},
-     {0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e6*/
-    {{0x1000000000UL, 0x44},
-     {0x10000000UL, 0x34},
-     {0x100000UL, 0x24},
-     {0x1000UL, 0x14},
-     {0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f6*/
-    {{0x2000000000UL, 0x45},
-     {0x20000000UL, 0x35},
-     {0x200000UL, 0x25},
-     {0x2000UL, 0x15},
-     {0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g6*/
-    {{0x4000000000UL, 0x46},
-     {0x40000000UL, 0x36},
-     {0x400000UL, 0x26},
-     {0x4000UL, 0x16},
-     {0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h6*/
-    {{0x8000000000UL, 0x47},
-     {0x80000000UL, 0x37},
-     {0x800000UL, 0x27},
-     {0x8000UL, 0x17},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a7*/
-    {{0x10000000000UL, 0x50},
-     {0x100000000UL, 0x40},
-     {0x1000000UL, 0x30},
-     {0x10000UL, 0x20},
-     {0x100UL, 0x10},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b7*/
-    {{0x20000000000UL, 0x51},
-     {0x200000000UL, 0x41},
-     {0x2000000UL, 0x31},
-     {0x20000UL, 0x21},
-     {0x200UL, 0x11},
-     {0x2UL, 0x1},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c7*/
-    {{0x40000000000UL, 0x52},
-     {0x400000000UL, 0x42},
-     {0x4000000UL, 0x32},
-     {0x40000UL, 0x22},
-     {0x400UL, 0x12},
-     {0x4UL, 0x2},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d7*/
-    {{0x80000000000UL, 0x53},
-     {0x800000000UL, 0x43},
-     {0x8000000UL, 0x33},
-     {0x80000UL, 0x23},
-     {0x800UL, 0x13},
-     {0x8UL, 0x3},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e7*/
-    {{0x100000000000UL, 0x54},
-     {0x1000000000UL, 0x44},
-     {0x10000000UL, 0x34},
-     {0x100000UL, 0x24},
-     {0x1000UL, 0x14},
-     {0x10UL, 0x4},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f7*/
-    {{0x200000000000UL, 0x55},
-     {0x2000000000UL, 0x45},
-     {0x20000000UL, 0x35},
-     {0x200000UL, 0x25},
-     {0x2000UL, 0x15},
-     {0x20UL, 0x5},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g7*/
-    {{0x400000000000UL, 0x56},
-     {0x4000000000UL, 0x46},
-     {0x40000000UL, 0x36},
-     {0x400000UL, 0x26},
-     {0x4000UL, 0x16},
-     {0x40UL, 0x6},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h7*/
-    {{0x800000000000UL, 0x57},
-     {0x8000000000UL, 0x47},
-     {0x80000000UL, 0x37},
-     {0x800000UL, 0x27},
-     {0x8000UL, 0x17},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a8*/
-    {{0x1000000000000UL, 0x60},
-     {0x10000000000UL, 0x50},
-     {0x100000000UL, 0x40},
-     {0x1000000UL, 0x30},
-     {0x10000UL, 0x20},
-     {0x100UL, 0x10},
-     {0x1UL, 0x0},
-     {0, 0x88}},
-    /*b8*/
-    {{0x2000000000000UL, 0x61},
-     {0x20000000000UL, 0x51},
-     {0x200000000UL, 0x41},
-     {0x2000000UL, 0x31},
-     {0x20000UL, 0x21},
-     {0x200UL, 0x11},
-     {0x2UL, 0x1},
-     {0, 0x88}},
-    /*c8*/
-    {{0x4000000000000UL, 0x62},
-     {0x40000000000UL, 0x52},
-     {0x400000000UL, 0x42},
-     {0x4000000UL, 0x32},
-     {0x40000UL, 0x22},
-     {0x400UL, 0x12},
-     {0x4UL, 0x2},
-     {0, 0x88}},
-    /*d8*/
-    {{0x8000000000000UL, 0x63},
-     {0x80000000000UL, 0x53},
-     {0x800000000UL, 0x43},
-     {0x8000000UL, 0x33},
-     {0x80000UL, 0x23},
-     {0x800UL, 0x13},
-     {0x8UL, 0x3},
-     {0, 0x88}},
-    /*e8*/
-    {{0x10000000000000UL, 0x64},
-     {0x100000000000UL, 0x54},
-     {0x1000000000UL, 0x44},
-     {0x10000000UL, 0x34},
-     {0x100000UL, 0x24},
-     {0x1000UL, 0x14},
-     {0x10UL, 0x4},
-     {0, 0x88}},
-    /*f8*/
-    {{0x20000000000000UL, 0x65},
-     {0x200000000000UL, 0x55},
-     {0x2000000000UL, 0x45},
-     {0x20000000UL, 0x35},
-     {0x200000UL, 0x25},
-     {0x2000UL, 0x15},
-     {0x20UL, 0x5},
-     {0, 0x88}},
-    /*g8*/
-    {{0x40000000000000UL, 0x66},
-     {0x400000000000UL, 0x56},
-     {0x4000000000UL, 0x46},
-     {0x40000000UL, 0x36},
-     {0x400000UL, 0x26},
-     {0x4000UL, 0x16},
-     {0x40UL, 0x6},
-     {0, 0x88}},
-    /*h8*/
-    {{0x80000000000000UL, 0x67},
-     {0x800000000000UL, 0x57},
-     {0x8000000000UL, 0x47},
-     {0x80000000UL, 0x37},
-     {0x800000UL, 0x27},
-     {0x8000UL, 0x17},
-     {0x80UL, 0x7},
-     {0, 0x88}},
+const uint64_t BISHOP_MAGICS[64] = {
+    /*a1*/ 0x2a02802004040UL,
+    /*b1*/ 0x20044112002504UL,
+    /*c1*/ 0x80042802004140c0UL,
+    /*d1*/ 0x184404189180100UL,
+    /*e1*/ 0x42021080000100UL,
+    /*f1*/ 0x8008902420114000UL,
+    /*g1*/ 0x44a2012420842000UL,
+    /*h1*/ 0x200240404840aUL,
+    /*a2*/ 0x1020021a022420UL,
+    /*b2*/ 0x2000600802005040UL,
+    /*c2*/ 0x1401000a20844a0UL,
+    /*d2*/ 0x240041042000806UL,
+    /*e2*/ 0x900040308000c00UL,
+    /*f2*/ 0x102082504100acUL,
+    /*g2*/ 0x400000410821100bUL,
+    /*h2*/ 0xc0460600410cd000UL,
+    /*a3*/ 0x2011044002080100UL,
+    /*b3*/ 0x1928221210044180UL,
+    /*c3*/ 0x121c08a840420200UL,
+    /*d3*/ 0x201202204c049UL,
+    /*e3*/ 0x9002000400940209UL,
+    /*f3*/ 0x8002004020900887UL,
+    /*g3*/ 0x821204248025010UL,
+    /*h3*/ 0x501e008108411c60UL,
+    /*a4*/ 0x2020090004310c11UL,
+    /*b4*/ 0x401040021040400UL,
+    /*c4*/ 0x264800101080b1UL,
+    /*d4*/ 0x1004040028401080UL,
+    /*e4*/ 0x130101001004008UL,
+    /*f4*/ 0x1104820081031080UL,
+    /*g4*/ 0x1402004440880808UL,
+    /*h4*/ 0x884002300420222UL,
+    /*a5*/ 0x2100809e4041000UL,
+    /*b5*/ 0x3410c3200101000UL,
+    /*c5*/ 0x81804104102404UL,
+    /*d5*/ 0x84a004044040100UL,
+    /*e5*/ 0x904010010040041UL,
+    /*f5*/ 0x821020080080801UL,
+    /*g5*/ 0x650840540008600UL,
+    /*h5*/ 0x4104080104400UL,
+    /*a6*/ 0x2004100410020410UL,
+    /*b6*/ 0x8088080200c818UL,
+    /*c6*/ 0x28400a0092021000UL,
+    /*d6*/ 0x48004010400200UL,
+    /*e6*/ 0x800664210a008400UL,
+    /*f6*/ 0x40140808802048UL,
+    /*g6*/ 0x900818c504001044UL,
+    /*h6*/ 0x10008884900902UL,
+    /*a7*/ 0xa000840120107081UL,
+    /*b7*/ 0x2004202306120UL,
+    /*c7*/ 0x5200b00000UL,
+    /*d7*/ 0x204000042020021UL,
+    /*e7*/ 0x42200084304c0820UL,
+    /*f7*/ 0x402821210501UL,
+    /*g7*/ 0x408020802040c0aUL,
+    /*h7*/ 0x10204a802004001UL,
+    /*a8*/ 0x8068a62206104001UL,
+    /*b8*/ 0x2818008a08010402UL,
+    /*c8*/ 0x8662010ca800UL,
+    /*d8*/ 0x8188000028208840UL,
+    /*e8*/ 0x4110600ca401UL,
+    /*f8*/ 0x514800411c480220UL,
+    /*g8*/ 0xc040200401420402UL,
+    /*h8*/ 0x42041004004289UL,
 };
-const bboard_and_square_t ROOK_RAY_E[64][8] = {
-    /*a1*/ {{0x2UL, 0x1},
-            {0x4UL, 0x2},
-            {0x8UL, 0x3},
-            {0x10UL, 0x4},
-            {0x20UL, 0x5},
-            {0x40UL, 0x6},
-            {0x80UL, 0x7},
-            {0, 0x88}},
-    /*b1*/
-    {{0x4UL, 0x2},
-     {0x8UL, 0x3},
-     {0x10UL, 0x4},
-     {0x20UL, 0x5},
-     {0x40UL, 0x6},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c1*/
-    {{0x8UL, 0x3},
-     {0x10UL, 0x4},
-     {0x20UL, 0x5},
-     {0x40UL, 0x6},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d1*/
-    {{0x10UL, 0x4},
-     {0x20UL, 0x5},
-     {0x40UL, 0x6},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e1*/
-    {{0x20UL, 0x5},
-     {0x40UL, 0x6},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f1*/
-    {{0x40UL, 0x6},
-     {0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g1*/
-    {{0x80UL, 0x7},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h1*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a2*/
-    {{0x200UL, 0x11},
-     {0x400UL, 0x12},
-     {0x800UL, 0x13},
-     {0x1000UL, 0x14},
-     {0x2000UL, 0x15},
-     {0x4000UL, 0x16},
-     {0x8000UL, 0x17},
-     {0, 0x88}},
-    /*b2*/
-    {{0x400UL, 0x12},
-     {0x800UL, 0x13},
-     {0x1000UL, 0x14},
-     {0x2000UL, 0x15},
-     {0x4000UL, 0x16},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c2*/
-    {{0x800UL, 0x13},
-     {0x1000UL, 0x14},
-     {0x2000UL, 0x15},
-     {0x4000UL, 0x16},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d2*/
-    {{0x1000UL, 0x14},
-     {0x2000UL, 0x15},
-     {0x4000UL, 0x16},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e2*/
-    {{0x2000UL, 0x15},
-     {0x4000UL, 0x16},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f2*/
-    {{0x4000UL, 0x16},
-     {0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g2*/
-    {{0x8000UL, 0x17},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h2*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a3*/
-    {{0x20000UL, 0x21},
-     {0x40000UL, 0x22},
-     {0x80000UL, 0x23},
-     {0x100000UL, 0x24},
-     {0x200000UL, 0x25},
-     {0x400000UL, 0x26},
-     {0x800000UL, 0x27},
-     {0, 0x88}},
-    /*b3*/
-    {{0x40000UL, 0x22},
-     {0x80000UL, 0x23},
-     {0x100000UL, 0x24},
-     {0x200000UL, 0x25},
-     {0x400000UL, 0x26},
-     {0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c3*/
-    {{0x80000UL, 0x23},
-     {0x100000UL, 0x24},
-     {0x200000UL, 0x25},
-     {0x400000UL, 0x26},
-     {0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d3*/
-    {{0x100000UL, 0x24},
-     {0x200000UL, 0x25},
-     {0x400000UL, 0x26},
-     {0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e3*/
-    {{0x200000UL, 0x25},
-     {0x400000UL, 0x26},
-     {0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f3*/
-    {{0x400000UL, 0x26},
-     {0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g3*/
-    {{0x800000UL, 0x27},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h3*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a4*/
-    {{0x2000000UL, 0x31},
-     {0x4000000UL, 0x32},
-     {0x8000000UL, 0x33},
-     {0x10000000UL, 0x34},
-     {0x20000000UL, 0x35},
-     {0x40000000UL, 0x36},
-     {0x80000000UL, 0x37},
-     {0, 0x88}},
-    /*b4*/
-    {{0x4000000UL, 0x32},
-     {0x8000000UL, 0x33},
-     {0x10000000UL, 0x34},
-     {0x20000000UL, 0x35},
-     {0x40000000UL, 0x36},
-     {0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c4*/
-    {{0x8000000UL, 0x33},
-     {0x10000000UL, 0x34},
-     {0x20000000UL, 0x35},
-     {0x40000000UL, 0x36},
-     {0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d4*/
-    {{0x10000000UL, 0x34},
-     {0x20000000UL, 0x35},
-     {0x40000000UL, 0x36},
-     {0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e4*/
-    {{0x20000000UL, 0x35},
-     {0x40000000UL, 0x36},
-     {0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f4*/
-    {{0x40000000UL, 0x36},
-     {0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g4*/
-    {{0x80000000UL, 0x37},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h4*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a5*/
-    {{0x200000000UL, 0x41},
-     {0x400000000UL, 0x42},
-     {0x800000000UL, 0x43},
-     {0x1000000000UL, 0x44},
-     {0x2000000000UL, 0x45},
-     {0x4000000000UL, 0x46},
-     {0x8000000000UL, 0x47},
-     {0, 0x88}},
-    /*b5*/
-    {{0x400000000UL, 0x42},
-     {0x800000000UL, 0x43},
-     {0x1000000000UL, 0x44},
-     {0x2000000000UL, 0x45},
-     {0x4000000000UL, 0x46},
-     {0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c5*/
-    {{0x800000000UL, 0x43},
-     {0x1000000000UL, 0x44},
-     {0x2000000000UL, 0x45},
-     {0x4000000000UL, 0x46},
-     {0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d5*/
-    {{0x1000000000UL, 0x44},
-     {0x2000000000UL, 0x45},
-     {0x4000000000UL, 0x46},
-     {0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e5*/
-    {{0x2000000000UL, 0x45},
-     {0x4000000000UL, 0x46},
-     {0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f5*/
-    {{0x4000000000UL, 0x46},
-     {0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g5*/
-    {{0x8000000000UL, 0x47},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h5*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a6*/
-    {{0x20000000000UL, 0x51},
-     {0x40000000000UL, 0x52},
-     {0x80000000000UL, 0x53},
-     {0x100000000000UL, 0x54},
-     {0x200000000000UL, 0x55},
-     {0x400000000000UL, 0x56},
-     {0x800000000000UL, 0x57},
-     {0, 0x88}},
-    /*b6*/
-    {{0x40000000000UL, 0x52},
-     {0x80000000000UL, 0x53},
-     {0x100000000000UL, 0x54},
-     {0x200000000000UL, 0x55},
-     {0x400000000000UL, 0x56},
-     {0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c6*/
-    {{0x80000000000UL, 0x53},
-     {0x100000000000UL, 0x54},
-     {0x200000000000UL, 0x55},
-     {0x400000000000UL, 0x56},
-     {0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d6*/
-    {{0x100000000000UL, 0x54},
-     {0x200000000000UL, 0x55},
-     {0x400000000000UL, 0x56},
-     {0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e6*/
-    {{0x200000000000UL, 0x55},
-     {0x400000000000UL, 0x56},
-     {0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f6*/
-    {{0x400000000000UL, 0x56},
-     {0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g6*/
-    {{0x800000000000UL, 0x57},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h6*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a7*/
-    {{0x2000000000000UL, 0x61},
-     {0x4000000000000UL, 0x62},
-     {0x8000000000000UL, 0x63},
-     {0x10000000000000UL, 0x64},
-     {0x20000000000000UL, 0x65},
-     {0x40000000000000UL, 0x66},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88}},
-    /*b7*/
-    {{0x4000000000000UL, 0x62},
-     {0x8000000000000UL, 0x63},
-     {0x10000000000000UL, 0x64},
-     {0x20000000000000UL, 0x65},
-     {0x40000000000000UL, 0x66},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c7*/
-    {{0x8000000000000UL, 0x63},
-     {0x10000000000000UL, 0x64},
-     {0x20000000000000UL, 0x65},
-     {0x40000000000000UL, 0x66},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d7*/
-    {{0x10000000000000UL, 0x64},
-     {0x20000000000000UL, 0x65},
-     {0x40000000000000UL, 0x66},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e7*/
-    {{0x20000000000000UL, 0x65},
-     {0x40000000000000UL, 0x66},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f7*/
-    {{0x40000000000000UL, 0x66},
-     {0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g7*/
-    {{0x80000000000000UL, 0x67},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h7*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*a8*/
-    {{0x200000000000000UL, 0x71},
-     {0x400000000000000UL, 0x72},
-     {0x800000000000000UL, 0x73},
-     {0x1000000000000000UL, 0x74},
-     {0x2000000000000000UL, 0x75},
-     {0x4000000000000000UL, 0x76},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88}},
-    /*b8*/
-    {{0x400000000000000UL, 0x72},
-     {0x800000000000000UL, 0x73},
-     {0x1000000000000000UL, 0x74},
-     {0x2000000000000000UL, 0x75},
-     {0x4000000000000000UL, 0x76},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c8*/
-    {{0x800000000000000UL, 0x73},
-     {0x1000000000000000UL, 0x74},
-     {0x2000000000000000UL, 0x75},
-     {0x4000000000000000UL, 0x76},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d8*/
-    {{0x1000000000000000UL, 0x74},
-     {0x2000000000000000UL, 0x75},
-     {0x4000000000000000UL, 0x76},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e8*/
-    {{0x2000000000000000UL, 0x75},
-     {0x4000000000000000UL, 0x76},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f8*/
-    {{0x4000000000000000UL, 0x76},
-     {0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g8*/
-    {{0x8000000000000000UL, 0x77},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
+const uint8_t BISHOP_SHIFTS[64] = {
+    /*a1*/ 58,
+    /*b1*/ 59,
+    /*c1*/ 59,
+    /*d1*/ 59,
+    /*e1*/ 59,
+    /*f1*/ 59,
+    /*g1*/ 59,
+    /*h1*/ 58,
+    /*a2*/ 59,
+    /*b2*/ 59,
+    /*c2*/ 59,
+    /*d2*/ 59,
+    /*e2*/ 59,
+    /*f2*/ 59,
+    /*g2*/ 59,
+    /*h2*/ 59,
+    /*a3*/ 59,
+    /*b3*/ 59,
+    /*c3*/ 57,
+    /*d3*/ 57,
+    /*e3*/ 57,
+    /*f3*/ 57,
+    /*g3*/ 59,
+    /*h3*/ 59,
+    /*a4*/ 59,
+    /*b4*/ 59,
+    /*c4*/ 57,
+    /*d4*/ 55,
+    /*e4*/ 55,
+    /*f4*/ 57,
+    /*g4*/ 59,
+    /*h4*/ 59,
+    /*a5*/ 59,
+    /*b5*/ 59,
+    /*c5*/ 57,
+    /*d5*/ 55,
+    /*e5*/ 55,
+    /*f5*/ 57,
+    /*g5*/ 59,
+    /*h5*/ 59,
+    /*a6*/ 59,
+    /*b6*/ 59,
+    /*c6*/ 57,
+    /*d6*/ 57,
+    /*e6*/ 57,
+    /*f6*/ 57,
+    /*g6*/ 59,
+    /*h6*/ 59,
+    /*a7*/ 59,
+    /*b7*/ 59,
+    /*c7*/ 59,
+    /*d7*/ 59,
+    /*e7*/ 59,
+    /*f7*/ 59,
+    /*g7*/ 59,
+    /*h7*/ 59,
+    /*a8*/ 58,
+    /*b8*/ 59,
+    /*c8*/ 59,
+    /*d8*/ 59,
+    /*e8*/ 59,
+    /*f8*/ 59,
+    /*g8*/ 59,
+    /*h8*/ 58,
 };
-const bboard_and_square_t ROOK_RAY_W[64][8] = {
-    /*a1*/ {{0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88},
-            {0, 0x88}},
-    /*b1*/
-    {{0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c1*/
-    {{0x2UL, 0x1},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d1*/
-    {{0x4UL, 0x2},
-     {0x2UL, 0x1},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e1*/
-    {{0x8UL, 0x3},
-     {0x4UL, 0x2},
-     {0x2UL, 0x1},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f1*/
-    {{0x10UL, 0x4},
-     {0x8UL, 0x3},
-     {0x4UL, 0x2},
-     {0x2UL, 0x1},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g1*/
-    {{0x20UL, 0x5},
-     {0x10UL, 0x4},
-     {0x8UL, 0x3},
-     {0x4UL, 0x2},
-     {0x2UL, 0x1},
-     {0x1UL, 0x0},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h1*/
-    {{0x40UL, 0x6},
-     {0x20UL, 0x5},
-     {0x10UL, 0x4},
-     {0x8UL, 0x3},
-     {0x4UL, 0x2},
-     {0x2UL, 0x1},
-     {0x1UL, 0x0},
-     {0, 0x88}},
-    /*a2*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b2*/
-    {{0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c2*/
-    {{0x200UL, 0x11},
-     {0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d2*/
-    {{0x400UL, 0x12},
-     {0x200UL, 0x11},
-     {0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e2*/
-    {{0x800UL, 0x13},
-     {0x400UL, 0x12},
-     {0x200UL, 0x11},
-     {0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f2*/
-    {{0x1000UL, 0x14},
-     {0x800UL, 0x13},
-     {0x400UL, 0x12},
-     {0x200UL, 0x11},
-     {0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g2*/
-    {{0x2000UL, 0x15},
-     {0x1000UL, 0x14},
-     {0x800UL, 0x13},
-     {0x400UL, 0x12},
-     {0x200UL, 0x11},
-     {0x100UL, 0x10},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h2*/
-    {{0x4000UL, 0x16},
-     {0x2000UL, 0x15},
-     {0x1000UL, 0x14},
-     {0x800UL, 0x13},
-     {0x400UL, 0x12},
-     {0x200UL, 0x11},
-     {0x100UL, 0x10},
-     {0, 0x88}},
-    /*a3*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b3*/
-    {{0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c3*/
-    {{0x20000UL, 0x21},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d3*/
-    {{0x40000UL, 0x22},
-     {0x20000UL, 0x21},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e3*/
-    {{0x80000UL, 0x23},
-     {0x40000UL, 0x22},
-     {0x20000UL, 0x21},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f3*/
-    {{0x100000UL, 0x24},
-     {0x80000UL, 0x23},
-     {0x40000UL, 0x22},
-     {0x20000UL, 0x21},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g3*/
-    {{0x200000UL, 0x25},
-     {0x100000UL, 0x24},
-     {0x80000UL, 0x23},
-     {0x40000UL, 0x22},
-     {0x20000UL, 0x21},
-     {0x10000UL, 0x20},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h3*/
-    {{0x400000UL, 0x26},
-     {0x200000UL, 0x25},
-     {0x100000UL, 0x24},
-     {0x80000UL, 0x23},
-     {0x40000UL, 0x22},
-     {0x20000UL, 0x21},
-     {0x10000UL, 0x20},
-     {0, 0x88}},
-    /*a4*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b4*/
-    {{0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c4*/
-    {{0x2000000UL, 0x31},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d4*/
-    {{0x4000000UL, 0x32},
-     {0x2000000UL, 0x31},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e4*/
-    {{0x8000000UL, 0x33},
-     {0x4000000UL, 0x32},
-     {0x2000000UL, 0x31},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f4*/
-    {{0x10000000UL, 0x34},
-     {0x8000000UL, 0x33},
-     {0x4000000UL, 0x32},
-     {0x2000000UL, 0x31},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g4*/
-    {{0x20000000UL, 0x35},
-     {0x10000000UL, 0x34},
-     {0x8000000UL, 0x33},
-     {0x4000000UL, 0x32},
-     {0x2000000UL, 0x31},
-     {0x1000000UL, 0x30},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h4*/
-    {{0x40000000UL, 0x36},
-     {0x20000000UL, 0x35},
-     {0x10000000UL, 0x34},
-     {0x8000000UL, 0x33},
-     {0x4000000UL, 0x32},
-     {0x2000000UL, 0x31},
-     {0x1000000UL, 0x30},
-     {0, 0x88}},
-    /*a5*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b5*/
-    {{0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c5*/
-    {{0x200000000UL, 0x41},
-     {0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d5*/
-    {{0x400000000UL, 0x42},
-     {0x200000000UL, 0x41},
-     {0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e5*/
-    {{0x800000000UL, 0x43},
-     {0x400000000UL, 0x42},
-     {0x200000000UL, 0x41},
-     {0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f5*/
-    {{0x1000000000UL, 0x44},
-     {0x800000000UL, 0x43},
-     {0x400000000UL, 0x42},
-     {0x200000000UL, 0x41},
-     {0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g5*/
-    {{0x2000000000UL, 0x45},
-     {0x1000000000UL, 0x44},
-     {0x800000000UL, 0x43},
-     {0x400000000UL, 0x42},
-     {0x200000000UL, 0x41},
-     {0x100000000UL, 0x40},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h5*/
-    {{0x4000000000UL, 0x46},
-     {0x2000000000UL, 0x45},
-     {0x1000000000UL, 0x44},
-     {0x800000000UL, 0x43},
-     {0x400000000UL, 0x42},
-     {0x200000000UL, 0x41},
-     {0x100000000UL, 0x40},
-     {0, 0x88}},
-    /*a6*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b6*/
-    {{0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c6*/
-    {{0x20000000000UL, 0x51},
-     {0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d6*/
-    {{0x40000000000UL, 0x52},
-     {0x20000000000UL, 0x51},
-     {0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e6*/
-    {{0x80000000000UL, 0x53},
-     {0x40000000000UL, 0x52},
-     {0x20000000000UL, 0x51},
-     {0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f6*/
-    {{0x100000000000UL, 0x54},
-     {0x80000000000UL, 0x53},
-     {0x40000000000UL, 0x52},
-     {0x20000000000UL, 0x51},
-     {0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g6*/
-    {{0x200000000000UL, 0x55},
-     {0x100000000000UL, 0x54},
-     {0x80000000000UL, 0x53},
-     {0x40000000000UL, 0x52},
-     {0x20000000000UL, 0x51},
-     {0x10000000000UL, 0x50},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h6*/
-    {{0x400000000000UL, 0x56},
-     {0x200000000000UL, 0x55},
-     {0x100000000000UL, 0x54},
-     {0x80000000000UL, 0x53},
-     {0x40000000000UL, 0x52},
-     {0x20000000000UL, 0x51},
-     {0x10000000000UL, 0x50},
-     {0, 0x88}},
-    /*a7*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b7*/
-    {{0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c7*/
-    {{0x2000000000000UL, 0x61},
-     {0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d7*/
-    {{0x4000000000000UL, 0x62},
-     {0x2000000000000UL, 0x61},
-     {0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e7*/
-    {{0x8000000000000UL, 0x63},
-     {0x4000000000000UL, 0x62},
-     {0x2000000000000UL, 0x61},
-     {0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f7*/
-    {{0x10000000000000UL, 0x64},
-     {0x8000000000000UL, 0x63},
-     {0x4000000000000UL, 0x62},
-     {0x2000000000000UL, 0x61},
-     {0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g7*/
-    {{0x20000000000000UL, 0x65},
-     {0x10000000000000UL, 0x64},
-     {0x8000000000000UL, 0x63},
-     {0x4000000000000UL, 0x62},
-     {0x2000000000000UL, 0x61},
-     {0x1000000000000UL, 0x60},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h7*/
-    {{0x40000000000000UL, 0x66},
-     {0x20000000000000UL, 0x65},
-     {0x10000000000000UL, 0x64},
-     {0x8000000000000UL, 0x63},
-     {0x4000000000000UL, 0x62},
-     {0x2000000000000UL, 0x61},
-     {0x1000000000000UL, 0x60},
-     {0, 0x88}},
-    /*a8*/
-    {{0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*b8*/
-    {{0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*c8*/
-    {{0x200000000000000UL, 0x71},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*d8*/
-    {{0x400000000000000UL, 0x72},
-     {0x200000000000000UL, 0x71},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*e8*/
-    {{0x800000000000000UL, 0x73},
-     {0x400000000000000UL, 0x72},
-     {0x200000000000000UL, 0x71},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*f8*/
-    {{0x1000000000000000UL, 0x74},
-     {0x800000000000000UL, 0x73},
-     {0x400000000000000UL, 0x72},
-     {0x200000000000000UL, 0x71},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88},
-     {0, 0x88}},
-    /*g8*/
-    {{0x2000000000000000UL, 0x75},
-     {0x1000000000000000UL, 0x74},
-     {0x800000000000000UL, 0x73},
-     {0x400000000000000UL, 0x72},
-     {0x200000000000000UL, 0x71},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88},
-     {0, 0x88}},
-    /*h8*/
-    {{0x4000000000000000UL, 0x76},
-     {0x2000000000000000UL, 0x75},
-     {0x1000000000000000UL, 0x74},
-     {0x800000000000000UL, 0x73},
-     {0x400000000000000UL, 0x72},
-     {0x200000000000000UL, 0x71},
-     {0x100000000000000UL, 0x70},
-     {0, 0x88}},
+const uint32_t BISHOP_OFFSETS[64] = {
+    /*a1*/ 0,
+    /*b1*/ 64,
+    /*c1*/ 96,
+    /*d1*/ 128,
+    /*e1*/ 160,
+    /*f1*/ 192,
+    /*g1*/ 224,
+    /*h1*/ 256,
+    /*a2*/ 320,
+    /*b2*/ 352,
+    /*c2*/ 384,
+    /*d2*/ 416,
+    /*e2*/ 448,
+    /*f2*/ 480,
+    /*g2*/ 512,
+    /*h2*/ 544,
+    /*a3*/ 576,
+    /*b3*/ 608,
+    /*c3*/ 640,
+    /*d3*/ 768,
+    /*e3*/ 896,
+    /*f3*/ 1024,
+    /*g3*/ 1152,
+    /*h3*/ 1184,
+    /*a4*/ 1216,
+    /*b4*/ 1248,
+    /*c4*/ 1280,
+    /*d4*/ 1408,
+    /*e4*/ 1920,
+    /*f4*/ 2432,
+    /*g4*/ 2560,
+    /*h4*/ 2592,
+    /*a5*/ 2624,
+    /*b5*/ 2656,
+    /*c5*/ 2688,
+    /*d5*/ 2816,
+    /*e5*/ 3328,
+    /*f5*/ 3840,
+    /*g5*/ 3968,
+    /*h5*/ 4000,
+    /*a6*/ 4032,
+    /*b6*/ 4064,
+    /*c6*/ 4096,
+    /*d6*/ 4224,
+    /*e6*/ 4352,
+    /*f6*/ 4480,
+    /*g6*/ 4608,
+    /*h6*/ 4640,
+    /*a7*/ 4672,
+    /*b7*/ 4704,
+    /*c7*/ 4736,
+    /*d7*/ 4768,
+    /*e7*/ 4800,
+    /*f7*/ 4832,
+    /*g7*/ 4864,
+    /*h7*/ 4896,
+    /*a8*/ 4928,
+    /*b8*/ 4992,
+    /*c8*/ 5024,
+    /*d8*/ 5056,
+    /*e8*/ 5088,
+    /*f8*/ 5120,
+    /*g8*/ 5152,
+    /*h8*/ 5184,
 };
 
 } // end-of extern "C"
@@ -0,0 +1,316 @@
+#include <libpopcnt.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+using namespace std;
+
+#include "game/Attacks.hpp"
+#include "game/BoardState.hpp"
+
+namespace siegbert {
+
+namespace {
+
+inline bool is_blank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/* reads a fen (or an epd) from left to right, without copying it : the first
+ * unexpected character throws a FenError */
+class FenReader {
+private:
+  string_view fen;
+
+  size_t pos;
+
+public:
+  explicit FenReader(string_view fen_) : fen(fen_), pos(0) {}
+
+  [[noreturn]] void fail(const char *expected) const {
+    throw FenError("invalid fen \"" + string(fen) + "\" : expected " +
+                       expected + " at column " + to_string(pos + 1),
+                   pos);
+  }
+
+  bool at_end() const { return pos >= fen.size(); }
+
+  char peek() const { return pos < fen.size() ? fen[pos] : '\0'; }
+
+  void skip() { pos += 1; }
+
+  void skip_blanks() {
+    while (pos < fen.size() && is_blank(fen[pos])) {
+      pos += 1;
+    }
+  }
+
+  /* the fields are separated by one blank or more */
+  void separator() {
+    if (!is_blank(peek())) {
+      fail("a space");
+    }
+    skip_blanks();
+  }
+
+  int number() {
+    const char c = peek();
+    if (c < '0' || c > '9') {
+      fail("a number");
+    }
+    int value = 0;
+    const auto result =
+        from_chars(fen.data() + pos, fen.data() + fen.size(), value);
+    if (result.ec != errc()) {
+      fail("a smaller number");
+    }
+    pos = result.ptr - fen.data();
+    return value;
+  }
+
+  /* what remains, without the surrounding blanks */
+  string_view rest() {
+    skip_blanks();
+    size_t end = fen.size();
+    while (end > pos && is_blank(fen[end - 1])) {
+      end -= 1;
+    }
+    return fen.substr(pos, end - pos);
+  }
+
+  void end() {
+    skip_blanks();
+    if (pos < fen.size()) {
+      fail("the end of the fen");
+    }
+  }
+};
+
+/* the counts a game can reach, checked as the pieces are placed : at most
+ * one king, and no more pawns and promoted pieces than the 8 initial pawns */
+void check_counts(const FenReader &reader, const State &side) {
+  if (side.king & (side.king - 1)) {
+    reader.fail("at most one king per side");
+  }
+  const int promoted = max(0, (int)popcnt64(side.knights) - 2) +
+                       max(0, (int)popcnt64(side.bishops) - 2) +
+                       max(0, (int)popcnt64(side.rooks) - 2) +
+                       max(0, (int)popcnt64(side.queens) - 1);
+  if ((int)popcnt64(side.pawns) + promoted > 8) {
+    reader.fail("at most 8 pawns and promoted pieces per side");
+  }
+}
+
+/* the four fields shared by the fen and the epd : pieces, side to move,
+ * castling rights and enpassant square */
+void read_position(FenReader &reader, BoardState &self) {
+  for (int row = 7; row >= 0; row -= 1) {
+    if (row < 7) {
+      if (reader.peek() != '/') {
+        reader.fail("'/'");
+      }
+      reader.skip();
+    }
+    int col = 0;
+    while (col < 8) {
+      const char c = reader.peek();
+      if (c >= '1' && c <= '8') {
+        if (col + (c - '0') > 8) {
+          reader.fail("at most 8 squares in the rank");
+        }
+        col += c - '0';
+      } else if (c != '\0' && strchr("pnbrqk", c)) {
+        self.black.enplace(c, SQUARE(row, col));
+        check_counts(reader, self.black);
+        col += 1;
+      } else if (c != '\0' && strchr("PNBRQK", c)) {
+        self.white.enplace(c - 'A' + 'a', SQUARE(row, col));
+        check_counts(reader, self.white);
+        col += 1;
+      } else {
+        reader.fail("a piece or a number of empty squares");
+      }
+      reader.skip();
+    }
+  }
+
+  /* turn */
+  reader.separator();
+  const char turn = reader.peek();
+  if (turn != 'w' && turn != 'b') {
+    reader.fail("'w' or 'b'");
+  }
+  self.white_to_move = turn == 'w';
+  reader.skip();
+
+  /* castlings */
+  reader.separator();
+  if (reader.peek() == '-') {
+    reader.skip();
+  } else {
+    if (!reader.peek() || !strchr("KQkq", reader.peek())) {
+      reader.fail("the castling rights or '-'");
+    }
+    for (char c = reader.peek(); c && strchr("KQkq", c); c = reader.peek()) {
+      self.white_castling.kingside |= c == 'K';
+      self.white_castling.queenside |= c == 'Q';
+      self.black_castling.kingside |= c == 'k';
+      self.black_castling.queenside |= c == 'q';
+      reader.skip();
+    }
+  }
+
+  /* enpassant */
+  reader.separator();
+  if (reader.peek() == '-') {
+    self.enpassant = 0;
+    reader.skip();
+  } else {
+    const char col = reader.peek();
+    if (col < 'a' || col > 'h') {
+      reader.fail("an enpassant square or '-'");
+    }
+    reader.skip();
+    const char row = reader.peek();
+    if (row != '3' && row != '6') {
+      reader.fail("the rank 3 or 6");
+    }
+    reader.skip();
+    self.enpassant = BBOARD(SQUARE(row - '1', col - 'a'));
+  }
+}
+
+/* writes the number, returns the next position */
+inline char *write_number(char *out, int value) {
+  return to_chars(out, out + 11, value).ptr;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+FenError::FenError(const string &what, size_t position_)
+    : invalid_argument(what), position(position_) {}
+
+////////////////////////////////////////////////////////////////////////////////
+BoardState BoardState::from_fen(string_view fen) {
+  BoardState self;
+  FenReader reader(fen);
+
+  reader.skip_blanks();
+  read_position(reader, self);
+  reader.separator();
+  self.halfmoves = reader.number();
+  reader.separator();
+  self.moves = reader.number();
+  reader.end();
+
+  self.recompute_z();
+  return self;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+BoardState BoardState::from_epd(string_view epd, string_view *operations) {
+  BoardState self;
+  FenReader reader(epd);
+
+  reader.skip_blanks();
+  read_position(reader, self);
+  if (!reader.at_end()) {
+    reader.separator();
+  }
+  const string_view rest = reader.rest();
+  if (operations) {
+    *operations = rest;
+  }
+  self.halfmoves = 0;
+  self.moves = 1;
+
+  self.recompute_z();
+  return self;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+char *BoardState::write_position(char *out) const {
+  /* pieces */
+  for (int row = 7; row >= 0; row -= 1) {
+    if (row < 7) {
+      *out++ = '/';
+    }
+    int empty = 0;
+    for (int col = 0; col < 8; col += 1) {
+      const char p = piece_at(SQUARE(row, col));
+      if (p == '\0') {
+        empty += 1;
+        continue;
+      }
+      if (empty > 0) {
+        *out++ = '0' + empty;
+        empty = 0;
+      }
+      *out++ = p;
+    }
+    if (empty > 0) {
+      *out++ = '0' + empty;
+    }
+  }
+
+  /* current player */
+  *out++ = ' ';
+  *out++ = white_to_move ? 'w' : 'b';
+
+  /* castlings */
+  *out++ = ' ';
+  char *const castlings = out;
+  if (white_castling.kingside) {
+    *out++ = 'K';
+  }
+  if (white_castling.queenside) {
+    *out++ = 'Q';
+  }
+  if (black_castling.kingside) {
+    *out++ = 'k';
+  }
+  if (black_castling.queenside) {
+    *out++ = 'q';
+  }
+  if (out == castlings) {
+    *out++ = '-';
+  }
+
+  /* enpassant */
+  *out++ = ' ';
+  if (enpassant) {
+    const square_t e = lsb(enpassant);
+    *out++ = 'a' + COL(e);
+    *out++ = '1' + ROW(e);
+  } else {
+    *out++ = '-';
+  }
+  return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int BoardState::write_fen(char *buffer) const {
+  char *out = write_position(buffer);
+  *out++ = ' ';
+  out = write_number(out, halfmoves);
+  *out++ = ' ';
+  out = write_number(out, moves);
+  return out - buffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int BoardState::write_epd(char *buffer) const {
+  return write_position(buffer) - buffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+string BoardState::to_fen() const {
+  char buffer[MAX_FEN_LENGTH];
+  return string(buffer, write_fen(buffer));
+}
+
+} // namespace siegbert
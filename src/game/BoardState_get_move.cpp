@@ -1,182 +1,142 @@
-#include <algorithm>
-#include <functional>
-#include <iostream>
-#include <regex>
-#include <vector>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 using namespace std;
 
 #include "game/BoardState.hpp"
 
 namespace siegbert {
 
-const regex re_xboard("^([a-h][1-8])([a-h][1-8])([nbrq])?$");
+namespace {
 
-std::function<bool(const Move &)>
-p_and(std::function<bool(const Move &)> left,
-      std::function<bool(const Move &)> right) {
-  return [left, right](const Move &m) -> bool { return left(m) && right(m); };
-}
-
-std::function<bool(const Move &)> p_from_square_matches(const string &spec) {
-  const square_t square = SQUARE(spec[1] - '1', spec[0] - 'a');
-  return [square](const Move &move) -> bool { return move.from == square; };
-}
-
-std::function<bool(const Move &)> p_to_square_matches(const string &spec) {
-  const square_t square = SQUARE(spec[1] - '1', spec[0] - 'a');
-  return [square](const Move &move) -> bool { return move.to == square; };
-}
-
-std::function<bool(const Move &)> p_promotion_matches(char piece) {
-  piece = tolower(piece);
-  return [piece](const Move &move) -> bool { return move.promotion == piece; };
-}
-
-std::function<bool(const Move &)> p_castling_kingside() {
-  return [](const Move &move) -> bool { return move.kingside_castling; };
-}
-
-std::function<bool(const Move &)> p_castling_queenside() {
-  return [](const Move &move) -> bool { return move.queenside_castling; };
-}
-
-std::function<bool(const Move &)> p_piece_is(char p) {
-  p = tolower(p);
-  return [p](const Move &move) -> bool { return move.piece == p; };
-}
-
-std::function<bool(const Move &)> p_is_capture() {
-  return [](const Move &move) -> bool { return move.captured != '\0'; };
-}
+inline bool is_col(char c) { return c >= 'a' && c <= 'h'; }
 
-std::function<bool(const Move &)> p_from_row_matches(char c) {
-  int row = c - '1';
-  return [row](const Move &move) -> bool { return ROW(move.from) == row; };
-}
+inline bool is_row(char c) { return c >= '1' && c <= '8'; }
 
-std::function<bool(const Move &)> p_from_col_matches(char c) {
-  int col = c - 'a';
-  return [col](const Move &move) -> bool { return COL(move.from) == col; };
+inline char to_lower(char c) {
+  return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-Move BoardState::get_move(const string &san_) const {
-
-  string san(san_);
-
-  // keep only what we care about
-  san.erase(remove(san.begin(), san.end(), '+'), san.end());
-  san.erase(remove(san.begin(), san.end(), '#'), san.end());
-
-  std::function<bool(const Move &)> predicate;
-  bool valid_predicate = false;
-
-  // xboard-style
-  cmatch m;
-  if (regex_match(san.c_str(), m, re_xboard)) {
-    valid_predicate = true;
-    string from;
-    from.assign(m[1].first, m[1].second);
-    predicate = p_from_square_matches(from);
-
-    string to;
-    to.assign(m[2].first, m[2].second);
-    predicate = p_and(predicate, p_to_square_matches(to));
-
-    if (m.length() == 5) {
-      char prom = *(m[3].first);
-      predicate = p_and(predicate, p_promotion_matches(tolower(prom)));
+/* what the notation tells about the move, -1 (or '\0') when unspecified */
+struct MoveSpec {
+  char piece = '\0';
+  int from_col = -1;
+  int from_row = -1;
+  int to = -1;
+  char promotion = '\0';
+  /* the promotion when none is given */
+  char default_promotion = '\0';
+  bool capture = false;
+  bool kingside_castling = false;
+  bool queenside_castling = false;
+
+  bool matches(const Move &move) const {
+    if (kingside_castling || queenside_castling) {
+      return move.kingside_castling == kingside_castling &&
+             move.queenside_castling == queenside_castling;
     }
+    return move.to == to && (!piece || move.piece == piece) &&
+           (from_col < 0 || COL(move.from) == from_col) &&
+           (from_row < 0 || ROW(move.from) == from_row) &&
+           (move.promotion == promotion ||
+            (!promotion && move.promotion == default_promotion)) &&
+           (!capture || move.captured);
   }
-
-  else if (san.compare("O-O") == 0) {
-    valid_predicate = true;
-    predicate = p_castling_kingside();
+};
+
+/* coordinate notation, as used by uci and xboard : "e2e4", "e7e8q". A
+ * promotion without its piece is a queen promotion */
+bool parse_coordinates(string_view s, MoveSpec &spec) {
+  if ((s.size() != 4 && s.size() != 5) || !is_col(s[0]) || !is_row(s[1]) ||
+      !is_col(s[2]) || !is_row(s[3])) {
+    return false;
   }
-
-  else if (san.compare("O-O-O") == 0) {
-    valid_predicate = true;
-    predicate = p_castling_queenside();
-  }
-
-  else {
-
-    predicate = [](const Move &) -> bool { return true; };
-    bool is_pawn_move = true;
-    // promotion
-    int index;
-    if ((index = san.find('=')) != string::npos) {
-      valid_predicate = true;
-      predicate = p_and(predicate, p_promotion_matches(san[index + 1]));
-      san = san.substr(0, san.length() - 2);
-    }
-
-    // piece spec
-    if (string("RNBQK").find(san[0]) != string::npos) {
-      valid_predicate = true;
-      is_pawn_move = false;
-      predicate = p_and(predicate, p_piece_is(san[0]));
-      san = san.substr(1);
-    } else {
-      predicate = p_and(predicate, p_piece_is('p'));
-    }
-
-    // capture
-    if (san.find('x') != string::npos) {
-      valid_predicate = true;
-      predicate = p_and(predicate, p_is_capture());
-      san.erase(remove(san.begin(), san.end(), 'x'), san.end());
+  if (s.size() == 5) {
+    const char promotion = to_lower(s[4]);
+    if (promotion != 'n' && promotion != 'b' && promotion != 'r' &&
+        promotion != 'q') {
+      return false;
     }
+    spec.promotion = promotion;
+  }
+  spec.default_promotion = 'q';
+  spec.from_col = s[0] - 'a';
+  spec.from_row = s[1] - '1';
+  spec.to = SQUARE(s[3] - '1', s[2] - 'a');
+  return true;
+}
 
-    // pawn moves
-    if (san.length() == 2) {
-      valid_predicate = true;
-      if (is_pawn_move) {
-        predicate = p_and(predicate, p_piece_is('p'));
-      }
-      predicate = p_and(predicate, p_to_square_matches(san));
-    } else {
-      valid_predicate = true;
-      predicate =
-          p_and(predicate, p_to_square_matches(san.substr(san.length() - 2)));
-      san = san.substr(0, san.length() - 2);
-      if (san.length()) {
-        for (char c : san) {
-          if (string("12345678").find(c) != string::npos) {
-            predicate = p_and(predicate, p_from_row_matches(c));
-          }
-          if (string("abcdefgh").find(c) != string::npos) {
-            predicate = p_and(predicate, p_from_col_matches(c));
-          }
-        }
-      }
-    }
+/* standard algebraic notation : "e4", "Nbd7", "exd5", "R1a3", "e8=Q",
+ * "O-O". The check and annotation marks are already removed */
+bool parse_san(string_view s, MoveSpec &spec) {
+  if (s == "O-O" || s == "0-0") {
+    spec.kingside_castling = true;
+    return true;
+  }
+  if (s == "O-O-O" || s == "0-0-0") {
+    spec.queenside_castling = true;
+    return true;
   }
 
-  if (valid_predicate) {
+  spec.piece = 'p';
+  if (!s.empty() && (s[0] == 'N' || s[0] == 'B' || s[0] == 'R' ||
+                     s[0] == 'Q' || s[0] == 'K')) {
+    spec.piece = to_lower(s[0]);
+    s.remove_prefix(1);
+  }
 
-    // get the moves that match the predicate
-    vector<Move> candidates;
-    vector<Move> moves = generate_moves();
-    for (auto &move : moves) {
-      if (predicate(move)) {
-        candidates.push_back(move);
+  /* promotion, with or without '=' */
+  if (spec.piece == 'p' && s.size() >= 3) {
+    const char promotion = to_lower(s.back());
+    if (promotion == 'n' || promotion == 'b' || promotion == 'r' ||
+        promotion == 'q') {
+      s.remove_suffix(1);
+      if (s.back() == '=') {
+        s.remove_suffix(1);
       }
+      spec.promotion = promotion;
     }
+  }
 
-    if (candidates.size() == 1) {
-      return candidates.front();
+  /* destination */
+  if (s.size() < 2 || !is_col(s[s.size() - 2]) || !is_row(s.back())) {
+    return false;
+  }
+  spec.to = SQUARE(s.back() - '1', s[s.size() - 2] - 'a');
+  s.remove_suffix(2);
+
+  /* disambiguation and capture */
+  for (const char c : s) {
+    if (is_col(c)) {
+      spec.from_col = c - 'a';
+    } else if (is_row(c)) {
+      spec.from_row = c - '1';
+    } else if (c == 'x' || c == ':') {
+      spec.capture = true;
+    } else if (c != '-') {
+      return false;
     }
+  }
+  return true;
+}
 
-    // find which move is the legal one if there are several matches
-    else if (candidates.size() > 1) {
+} // namespace
 
-      BoardState cpy(*this);
+////////////////////////////////////////////////////////////////////////////////
+Move BoardState::get_move(string_view san) const {
+  /* check marks and annotations */
+  while (!san.empty() && (san.back() == '+' || san.back() == '#' ||
+                          san.back() == '!' || san.back() == '?')) {
+    san.remove_suffix(1);
+  }
 
-      for (auto &move : candidates) {
-        if (cpy.make_move(move)) {
-          return move;
-        }
+  MoveSpec spec;
+  if (parse_coordinates(san, spec) || parse_san(san, spec)) {
+    MoveList moves;
+    generate_legal_moves(moves);
+    for (auto &move : moves) {
+      if (spec.matches(move)) {
+        return move;
       }
     }
   }
@@ -0,0 +1,169 @@
+#include <algorithm>
+using namespace std;
+
+#include "game/Attacks.hpp"
+#include "game/BoardState.hpp"
+#include "game/BoardState_constants.hpp"
+
+namespace siegbert {
+
+/* what the move wins before any recapture */
+static inline int captured_value(const Move &move) {
+  int value = material_value(move.captured);
+  if (move.promotion) {
+    value += material_value(move.promotion) - material_value('p');
+  }
+  return value;
+}
+
+/* removes the least valuable of the attackers of this side from occupied, and
+ * adds the sliders it was hiding to the attackers. Returns the piece */
+static inline char pop_least_valuable(const State &side,
+                                      uint64_t side_attackers, int to,
+                                      uint64_t &occupied, uint64_t &attackers,
+                                      uint64_t diagonal_sliders,
+                                      uint64_t orthogonal_sliders) {
+  const uint64_t boards[6] = {side.pawns, side.knights, side.bishops,
+                              side.rooks, side.queens,  side.king};
+  for (int i = 0; i < 6; i += 1) {
+    const uint64_t candidates = side_attackers & boards[i];
+    if (!candidates) {
+      continue;
+    }
+    const char piece = "pnbrqk"[i];
+    occupied ^= candidates & -candidates;
+    if (piece == 'p' || piece == 'b' || piece == 'q') {
+      attackers |= bishop_attacks(to, occupied) & diagonal_sliders;
+    }
+    if (piece == 'r' || piece == 'q') {
+      attackers |= rook_attacks(to, occupied) & orthogonal_sliders;
+    }
+    attackers &= occupied;
+    return piece;
+  }
+  return '\0';
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint64_t BoardState::see_occupancy(const Move &move) const {
+  uint64_t occupied = (white.presence | black.presence) ^ BBOARD(move.from);
+  if (move.enpassant) {
+    occupied ^= BBOARD(white_to_move ? move.to - 8 : move.to + 8);
+  }
+  return occupied;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int BoardState::see(const Move &move) const {
+  if (move.kingside_castling || move.queenside_castling) {
+    return 0;
+  }
+
+  const int to = move.to;
+  uint64_t occupied = see_occupancy(move);
+  uint64_t attackers = (white.attackers_to(to, occupied, true) |
+                        black.attackers_to(to, occupied, false)) &
+                       occupied;
+  const uint64_t diagonal_sliders =
+      white.diagonal_sliders() | black.diagonal_sliders();
+  const uint64_t orthogonal_sliders =
+      white.orthogonal_sliders() | black.orthogonal_sliders();
+
+  /* gain[d] is what the side making the d-th capture wins if the exchange
+   * stops right after it. There are less than 32 captures on a square */
+  int gain[32];
+  int d = 0;
+  gain[0] = captured_value(move);
+  int on_square = material_value(move.promotion ? move.promotion : move.piece);
+  bool white_side = !white_to_move;
+
+  while (true) {
+    const State &side = white_side ? white : black;
+    const uint64_t side_attackers = attackers & side.presence;
+    if (!side_attackers) {
+      break;
+    }
+    d += 1;
+    gain[d] = on_square - gain[d - 1];
+    const char piece =
+        pop_least_valuable(side, side_attackers, to, occupied, attackers,
+                           diagonal_sliders, orthogonal_sliders);
+
+    /* the king may only take the last piece */
+    if (piece == 'k' && (attackers & (white_side ? black : white).presence)) {
+      d -= 1;
+      break;
+    }
+    on_square = material_value(piece);
+    white_side = !white_side;
+  }
+
+  /* each side may also stop capturing */
+  while (d > 0) {
+    gain[d - 1] = -max(-gain[d - 1], gain[d]);
+    d -= 1;
+  }
+  return gain[0];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool BoardState::see_ge(const Move &move, int threshold) const {
+  if (move.kingside_castling || move.queenside_castling) {
+    return 0 >= threshold;
+  }
+
+  /* balance of the exchange for the side to move, compared to the
+   * threshold : below 0 even if the piece is not taken back, above 0 even if
+   * it is */
+  int swap = captured_value(move) - threshold;
+  if (swap < 0) {
+    return false;
+  }
+  swap = material_value(move.promotion ? move.promotion : move.piece) - swap;
+  if (swap <= 0) {
+    return true;
+  }
+
+  const int to = move.to;
+  uint64_t occupied = see_occupancy(move);
+  uint64_t attackers = (white.attackers_to(to, occupied, true) |
+                        black.attackers_to(to, occupied, false)) &
+                       occupied;
+  const uint64_t diagonal_sliders =
+      white.diagonal_sliders() | black.diagonal_sliders();
+  const uint64_t orthogonal_sliders =
+      white.orthogonal_sliders() | black.orthogonal_sliders();
+
+  /* true while the side to move reaches the threshold */
+  bool result = true;
+  bool white_side = !white_to_move;
+
+  while (true) {
+    const State &side = white_side ? white : black;
+    const uint64_t side_attackers = attackers & side.presence;
+    if (!side_attackers) {
+      break;
+    }
+    result = !result;
+    const char piece =
+        pop_least_valuable(side, side_attackers, to, occupied, attackers,
+                           diagonal_sliders, orthogonal_sliders);
+
+    /* the king may only take the last piece */
+    if (piece == 'k') {
+      return attackers & (white_side ? black : white).presence ? !result
+                                                               : result;
+    }
+
+    /* the side that has just captured is still on the right side of the
+     * threshold if its piece is taken back : it is done */
+    swap = material_value(piece) - swap;
+    if (swap < (result ? 1 : 0)) {
+      break;
+    }
+    white_side = !white_side;
+  }
+  return result;
+}
+
+} // namespace siegbert
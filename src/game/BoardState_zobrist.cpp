@@ -1,6 +1,11 @@
 
 
 #include "game/BoardState.hpp"
+#include <libpopcnt.h>
+
+#include <cassert>
+
+#include "game/Attacks.hpp"
 #include "game/BoardState_constants.hpp"
 
 /* The seed that is used for polyglot zobrist hashes */
@@ -287,21 +292,64 @@ static inline int piece_value(char piece) {
   return -1;
 }
 
+/* the key of a piece on a square, valoffset being 1 for the white pieces */
+static inline uint64_t piece_key(char piece, int valoffset, int square) {
+  return zobrist_random64[64 * (piece_value(piece) + valoffset) + square];
+}
+
+/* the keys of the material, independent from the polyglot ones so that the
+ * material key is not correlated with the zobrist hash. They are drawn with
+ * splitmix64, at compile time */
+struct MaterialKeys {
+  /* indexed by piece_value() + valoffset, then by the count : there are at
+   * most 10 pieces of a kind (8 promotions and the 2 initial pieces) */
+  uint64_t keys[12][10];
+
+  constexpr MaterialKeys() : keys{} {
+    uint64_t state = 0x6D6174657269616CULL;
+    for (auto &piece_keys : keys) {
+      for (auto &key : piece_keys) {
+        state += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = state;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        key = z ^ (z >> 31);
+      }
+    }
+  }
+};
+
+static constexpr MaterialKeys material_keys;
+
+/* the material key is the xor of the keys of the nth piece of each kind, for
+ * n below the number of such pieces. from_fen() rejects the counts a game
+ * cannot reach */
+static inline uint64_t nth_piece_key(char piece, int valoffset, int nth) {
+  assert(nth >= 0 && nth < 10);
+  return material_keys.keys[piece_value(piece) + valoffset][nth];
+}
+
 void BoardState::recompute_z() {
 
   // pieces
   uint64_t p = 0;
-  const Piece *pp;
-  pp = white.pieces;
-  while (pp->name) {
-    p ^=
-        zobrist_random64[64 * (1 + piece_value(pp->name)) + OFFSET(pp->square)];
-    pp += 1;
-  }
-  pp = black.pieces;
-  while (pp->name) {
-    p ^= zobrist_random64[64 * piece_value(pp->name) + OFFSET(pp->square)];
-    pp += 1;
+  pawn_key = 0;
+  material_key = 0;
+  for (char piece : {'p', 'n', 'b', 'r', 'q', 'k'}) {
+    for (int valoffset = 0; valoffset < 2; valoffset += 1) {
+      const uint64_t bboard = (valoffset ? white : black).bitboard(piece);
+      for (uint64_t b = bboard; b;) {
+        const uint64_t key = piece_key(piece, valoffset, pop_lsb(b));
+        p ^= key;
+        if (piece == 'p' || piece == 'k') {
+          pawn_key ^= key;
+        }
+      }
+      const int count = piece == 'k' ? 0 : popcnt64(bboard);
+      for (int n = 0; n < count; n += 1) {
+        material_key ^= nth_piece_key(piece, valoffset, n);
+      }
+    }
   }
 
   // castling rights
@@ -323,11 +371,11 @@ void BoardState::recompute_z() {
   uint64_t e = 0;
   // we consider the enpassant square only if a real capture could occur
   if (enpassant) {
-    square_t epsquare = square_for_bboard(enpassant);
+    square_t epsquare = lsb(enpassant);
     if ((!white_to_move &&
-         (WHITE_PAWN_CAPTURES[OFFSET(epsquare)] & black.pawns)) ||
+         (WHITE_PAWN_CAPTURES[epsquare] & black.pawns)) ||
         (white_to_move &&
-         (BLACK_PAWN_CAPTURES[OFFSET(epsquare)] & white.pawns))) {
+         (BLACK_PAWN_CAPTURES[epsquare] & white.pawns))) {
       e = zobrist_random64[772 + COL(epsquare)];
     }
   }
@@ -338,75 +386,93 @@ void BoardState::recompute_z() {
   z = p ^ c ^ e ^ t;
 }
 
-void BoardState::evolve_z(const Move &move, const Castling &previous_castling,
+template <Color Us>
+void BoardState::evolve_z(const Move &move,
+                          const Castling &previous_white_castling,
+                          const Castling &previous_black_castling,
                           int previous_halfmoves, uint64_t previous_enpassant) {
 
-  int valoffset = white_to_move ? 0 : 1;
+  // white pieces come after the black ones of the same kind
+  constexpr int valoffset = Us == WHITE ? 1 : 0;
+  constexpr int nvaloffset = 1 - valoffset;
+  constexpr int row = Us == WHITE ? 0 : 7;
 
   // for castling, update the hash for the rook move
   if (move.kingside_castling) {
-    int row = white_to_move ? 7 : 0;
-    int base = 64 * (piece_value('r') + valoffset);
-    z ^= zobrist_random64[base + OFFSET(SQUARE(row, 7))];
-    z ^= zobrist_random64[base + OFFSET(SQUARE(row, 5))];
+    z ^= piece_key('r', valoffset, SQUARE(row, 7));
+    z ^= piece_key('r', valoffset, SQUARE(row, 5));
   } else if (move.queenside_castling) {
-    int row = white_to_move ? 7 : 0;
-    int base = 64 * (piece_value('r') + valoffset);
-    z ^= zobrist_random64[base + OFFSET(SQUARE(row, 0))];
-    z ^= zobrist_random64[base + OFFSET(SQUARE(row, 3))];
+    z ^= piece_key('r', valoffset, SQUARE(row, 0));
+    z ^= piece_key('r', valoffset, SQUARE(row, 3));
   }
 
   // if the move is a capture
   else if (move.captured) {
 
-    int nvaloffset = valoffset ? 0 : 1;
+    State &opponent = Us == WHITE ? black : white;
 
     if (move.enpassant) {
-      int capture_row = white_to_move ? 3 : 4;
-      int capture_col = COL(move.to);
-      z ^= zobrist_random64[64 * (piece_value('p') + nvaloffset) +
-                            capture_row * 8 + capture_col];
+      constexpr int capture_row = Us == WHITE ? 4 : 3;
+      const uint64_t key =
+          piece_key('p', nvaloffset, SQUARE(capture_row, COL(move.to)));
+      z ^= key;
+      pawn_key ^= key;
     } else {
-      int cap_value = piece_value(move.captured) + nvaloffset;
-      z ^= zobrist_random64[64 * cap_value + OFFSET(move.to)];
+      const uint64_t key = piece_key(move.captured, nvaloffset, move.to);
+      z ^= key;
+      if (move.captured == 'p') {
+        pawn_key ^= key;
+      }
     }
+
+    // the board is already updated : the count is the index of the piece
+    // that has been taken
+    material_key ^=
+        nth_piece_key(move.captured, nvaloffset,
+                      popcnt64(opponent.bitboard(move.captured)));
   }
 
   // normal move : disappear from board
-  z ^= zobrist_random64[64 * (piece_value(move.piece) + valoffset) +
-                        OFFSET(move.from)];
+  const uint64_t from_key = piece_key(move.piece, valoffset, move.from);
+  z ^= from_key;
 
   // reappear
   if (move.promotion) {
-    z ^= zobrist_random64[64 * (piece_value(move.promotion) + valoffset) +
-                          OFFSET(move.to)];
+    State &moving = Us == WHITE ? white : black;
+    z ^= piece_key(move.promotion, valoffset, move.to);
+    pawn_key ^= from_key;
+    material_key ^=
+        nth_piece_key('p', valoffset, popcnt64(moving.pawns)) ^
+        nth_piece_key(move.promotion, valoffset,
+                      popcnt64(moving.bitboard(move.promotion)) - 1);
   } else {
-    z ^= zobrist_random64[64 * (piece_value(move.piece) + valoffset) +
-                          OFFSET(move.to)];
+    const uint64_t to_key = piece_key(move.piece, valoffset, move.to);
+    z ^= to_key;
+    if (move.piece == 'p' || move.piece == 'k') {
+      pawn_key ^= from_key ^ to_key;
+    }
   }
 
-  // castling
-  if (white_to_move) {
-    if (black_castling.kingside != previous_castling.kingside) {
-      z ^= zobrist_random64[770];
-    }
-    if (black_castling.queenside != previous_castling.queenside) {
-      z ^= zobrist_random64[771];
-    }
-  } else {
-    if (white_castling.kingside != previous_castling.kingside) {
-      z ^= zobrist_random64[768];
-    }
-    if (white_castling.queenside != previous_castling.queenside) {
-      z ^= zobrist_random64[769];
-    }
+  // castling : the move may have changed the rights of both sides (capturing
+  // a rook on its initial square removes the opponent's right)
+  if (white_castling.kingside != previous_white_castling.kingside) {
+    z ^= zobrist_random64[768];
+  }
+  if (white_castling.queenside != previous_white_castling.queenside) {
+    z ^= zobrist_random64[769];
+  }
+  if (black_castling.kingside != previous_black_castling.kingside) {
+    z ^= zobrist_random64[770];
+  }
+  if (black_castling.queenside != previous_black_castling.queenside) {
+    z ^= zobrist_random64[771];
   }
 
   /* enpassant : xor with previous value again in order to
    * to revert the hash (if it was zero, z remains unchanged)
    */
   if (previous_enpassant) {
-    z ^= zobrist_random64[772 + COL(square_for_bboard(previous_enpassant))];
+    z ^= zobrist_random64[772 + COL(lsb(previous_enpassant))];
   }
 
   /*
@@ -414,11 +480,9 @@ void BoardState::evolve_z(const Move &move, const Castling &previous_castling,
    */
   // we consider the enpassant square only if a real capture could occur
   if (enpassant) {
-    square_t epsquare = square_for_bboard(enpassant);
-    if ((!white_to_move &&
-         (WHITE_PAWN_CAPTURES[OFFSET(epsquare)] & black.pawns)) ||
-        (white_to_move &&
-         (BLACK_PAWN_CAPTURES[OFFSET(epsquare)] & white.pawns))) {
+    square_t epsquare = lsb(enpassant);
+    if (Us == WHITE ? WHITE_PAWN_CAPTURES[epsquare] & black.pawns
+                    : BLACK_PAWN_CAPTURES[epsquare] & white.pawns) {
       z ^= zobrist_random64[772 + COL(epsquare)];
     }
   }
@@ -429,4 +493,17 @@ void BoardState::evolve_z(const Move &move, const Castling &previous_castling,
   z ^= zobrist_random64[780];
 }
 
+void BoardState::evolve_z_null_move(uint64_t previous_enpassant) {
+  // no piece moves, and no enpassant capture is possible after a null move
+  if (previous_enpassant) {
+    z ^= zobrist_random64[772 + COL(lsb(previous_enpassant))];
+  }
+  z ^= zobrist_random64[780];
+}
+
+template void BoardState::evolve_z<WHITE>(const Move &, const Castling &,
+                                          const Castling &, int, uint64_t);
+template void BoardState::evolve_z<BLACK>(const Move &, const Castling &,
+                                          const Castling &, int, uint64_t);
+
 } // namespace siegbert
\ No newline at end of file
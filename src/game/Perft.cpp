@@ -0,0 +1,140 @@
+#include "game/Perft.hpp"
+
+#include <chrono>
+#include <memory>
+#include <sstream>
+
+#include "threading/threading.hpp"
+
+using namespace std;
+
+namespace siegbert {
+
+////////////////////////////////////////////////////////////////////////////////
+PerftHashTable::PerftHashTable(size_t megabytes) {
+  size_t n = 1;
+  const size_t wanted = (megabytes << 20) / sizeof(Entry);
+  while (n * 2 <= wanted) {
+    n *= 2;
+  }
+  entries = vector<Entry>(n);
+  mask = n - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool PerftHashTable::find(uint64_t z, int depth, uint64_t &nodes) {
+  Entry &entry = entries[z & mask];
+  const uint64_t data = entry.data.load(memory_order_relaxed);
+  const uint64_t check = entry.check.load(memory_order_relaxed);
+  if ((check ^ data) == z && (int)(data & 0xff) == depth) {
+    nodes = data >> 8;
+    return true;
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PerftHashTable::put(uint64_t z, int depth, uint64_t nodes) {
+  Entry &entry = entries[z & mask];
+  const uint64_t data = (nodes << 8) | (uint64_t)depth;
+  entry.check.store(z ^ data, memory_order_relaxed);
+  entry.data.store(data, memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+PerftResult::PerftResult() : nodes(0), seconds(0) {}
+
+////////////////////////////////////////////////////////////////////////////////
+uint64_t PerftResult::nps() const {
+  return seconds > 0 ? (uint64_t)(nodes / seconds) : nodes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+string PerftResult::to_str() const {
+  ostringstream ss;
+  for (auto &item : divide) {
+    ss << item.first.to_str() << ": " << item.second << '\n';
+  }
+  ss << "nodes " << nodes << " time " << (uint64_t)(seconds * 1000) << " nps "
+     << nps();
+  return ss.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint64_t perft(BoardState &boardState, int depth, PerftHashTable *table) {
+  if (depth == 0) {
+    return 1;
+  }
+
+  /* bulk counting : the leaves are neither generated nor played */
+  if (depth == 1) {
+    return boardState.count_legal_moves();
+  }
+
+  uint64_t nodes = 0;
+  const uint64_t z = boardState.get_zobrist_hash();
+  if (table && table->find(z, depth, nodes)) {
+    return nodes;
+  }
+
+  MoveList moves;
+  boardState.generate_legal_moves(moves);
+
+  const Memento memento = boardState.memento();
+  for (auto &move : moves) {
+    boardState.make_legal_move(move);
+    nodes += perft(boardState, depth - 1, table);
+    boardState.unmake_move(move, memento);
+  }
+
+  if (table) {
+    table->put(z, depth, nodes);
+  }
+  return nodes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+PerftResult perft_divide(const BoardState &boardState, int depth,
+                         int n_threads, size_t hash_megabytes) {
+  const auto start = chrono::steady_clock::now();
+  PerftResult result;
+
+  /* a depth 0 perft counts the root itself */
+  if (depth <= 0) {
+    result.nodes = 1;
+    return result;
+  }
+
+  unique_ptr<PerftHashTable> table;
+  if (hash_megabytes > 0) {
+    table.reset(new PerftHashTable(hash_megabytes));
+  }
+  PerftHashTable *shared_table = table.get();
+
+  vector<Move> moves = boardState.generate_legal_moves();
+  vector<Future<uint64_t> *> futures;
+  {
+    ThreadPool pool(n_threads);
+    for (auto &move : moves) {
+      futures.push_back(pool.submit<uint64_t>(
+          [&boardState, move, depth, shared_table]() -> uint64_t {
+            BoardState copy(boardState);
+            copy.make_legal_move(move);
+            return perft(copy, depth - 1, shared_table);
+          }));
+    }
+    for (size_t i = 0; i < moves.size(); i += 1) {
+      const uint64_t nodes = futures[i]->get();
+      delete futures[i];
+      result.divide.push_back(make_pair(moves[i], nodes));
+      result.nodes += nodes;
+    }
+  }
+
+  result.seconds = chrono::duration<double>(chrono::steady_clock::now() -
+                                            start)
+                       .count();
+  return result;
+}
+
+} // namespace siegbert
@@ -0,0 +1,67 @@
+#pragma once
+#ifndef Perft_HPP
+#define Perft_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "game/BoardState.hpp"
+
+namespace siegbert {
+
+/**
+ * Subtree sizes already counted, indexed by the zobrist hash of the position.
+ * The table may be shared by several threads : as in the transposition table,
+ * each entry stores (key ^ data, data) so that torn writes are seen as misses.
+ */
+class PerftHashTable {
+private:
+  struct Entry {
+    std::atomic<uint64_t> check; /* key ^ data */
+    std::atomic<uint64_t> data;  /* nodes << 8 | depth */
+  };
+
+  std::vector<Entry> entries;
+
+  uint64_t mask;
+
+public:
+  PerftHashTable(size_t megabytes = 16);
+
+  bool find(uint64_t z, int depth, uint64_t &nodes);
+
+  void put(uint64_t z, int depth, uint64_t nodes);
+};
+
+struct PerftResult {
+  PerftResult();
+
+  uint64_t nodes;
+
+  /** nodes below each of the root moves */
+  std::vector<std::pair<Move, uint64_t>> divide;
+
+  double seconds;
+
+  uint64_t nps() const;
+
+  /** one "move: nodes" line per root move, then the totals */
+  std::string to_str() const;
+};
+
+/** number of leaf nodes at the given depth, table may be null */
+uint64_t perft(BoardState &boardState, int depth,
+               PerftHashTable *table = nullptr);
+
+/** perft where the root moves are dispatched to n_threads threads (0 for one
+ * per core). Subtrees are cached in a table of hash_megabytes, unless 0 */
+PerftResult perft_divide(const BoardState &boardState, int depth,
+                         int n_threads = 0, size_t hash_megabytes = 16);
+
+} // namespace siegbert
+
+#endif
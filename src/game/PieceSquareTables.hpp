@@ -0,0 +1,49 @@
+#pragma once
+#ifndef PieceSquareTables_HPP
+#define PieceSquareTables_HPP
+
+#include <cstdint>
+
+/*
+ Piece-square tables, for a tapered evaluation : each piece has a midgame
+ and an endgame value, which are blended according to the material left on
+ the board (the phase).
+
+ The values are the PeSTO ones
+ (https://www.chessprogramming.org/PeSTO%27s_Evaluation_Function). The tables
+ are laid out as a board is printed, a8 first : the square of a white piece
+ is read at square ^ 56, the square of a black piece is read as is.
+*/
+
+namespace siegbert {
+
+/** phase of the initial position, 0 being a pawns and kings endgame */
+const int PSQ_MAX_PHASE = 24;
+
+/** indexed by psq_index() */
+extern const int PSQ_MATERIAL_MG[6];
+extern const int PSQ_MATERIAL_EG[6];
+extern const int PSQ_PHASE[6];
+extern const int16_t PSQ_MG[6][64];
+extern const int16_t PSQ_EG[6][64];
+
+/** index of a kind of piece in the tables */
+inline int psq_index(char piece) {
+  switch (piece) {
+  case 'p':
+    return 0;
+  case 'n':
+    return 1;
+  case 'b':
+    return 2;
+  case 'r':
+    return 3;
+  case 'q':
+    return 4;
+  }
+  return 5;
+}
+
+} // namespace siegbert
+
+#endif
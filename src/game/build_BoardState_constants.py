@@ -1,93 +1,286 @@
+import random
 import sys
 
-    def is_valid(row, col) : return 0 <= row<8 and 0 <= col<8
 
-                 def coord(row, col) : return 'abcdefgh'[col] + str(row + 1)
+def is_valid(row, col):
+    return 0 <= row < 8 and 0 <= col < 8
 
-                               def sq88(row, col) : return hex(16 * row + col)
 
-                                            def bboard_hex(row, col) : bboard = 1 <<(row * 8 + col) return hex(bboard) + 'UL'
+def coord(row, col):
+    return 'abcdefgh'[col] + str(row + 1)
 
-                                                           def knight_moves(row, col) : for drow, dcol in[(1, 2), (1, - 2), (- 1, 2), (- 1, - 2), (2, 1), (2, - 1), (- 2, 1), (- 2, - 1)] : i, j = row + drow, col + dcol if is_valid (i, j) : yield(i, j)
 
-                                                                                                                                                                                                                                                         def white_pawn_captures(row, col) : if is_valid (row + 1, col - 1) : yield row + 1, col - 1 if is_valid (row + 1, col + 1) : yield row + 1, col + 1
+def bboard_hex(row, col):
+    bboard = 1 << (row * 8 + col)
+    return hex(bboard) + 'UL'
 
-                                                                                                                                                                                                                                                                                                                                                                  def black_pawn_captures(row, col) : if is_valid (row - 1, col - 1) : yield row - 1, col - 1 if is_valid (row - 1, col + 1) : yield row - 1, col + 1
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                           def king_moves(row, col) : for drow in[- 1, 0, 1] : for dcol in[- 1, 0, 1] : if (drow, dcol) !=(0, 0) and is_valid(row + drow, col + dcol) : yield(row + drow, col + dcol)
+def knight_moves(row, col):
+    for drow, dcol in [(1, 2), (1, -2), (-1, 2), (-1, -2), (2, 1), (2, -1),
+                       (-2, 1), (-2, -1)]:
+        i, j = row + drow, col + dcol
+        if is_valid(i, j):
+            yield (i, j)
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                  def ray(row, col, drow, dcol) : row = row + drow col = col + dcol while is_valid(row, col) : yield row, col row = row + drow col = col + dcol
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   def bishop_ray_ne(row, col) : yield from ray(row, col, 1, 1) def bishop_ray_se(row, col) : yield from ray(row, col, - 1, 1) def bishop_ray_nw(row, col) : yield from ray(row, col, 1, - 1) def bishop_ray_sw(row, col) : yield from ray(row, col, - 1, - 1)
+def white_pawn_captures(row, col):
+    if is_valid(row + 1, col - 1):
+        yield row + 1, col - 1
+    if is_valid(row + 1, col + 1):
+        yield row + 1, col + 1
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               def rook_ray_n(row, col) : yield from ray(row, col, 1, 0) def rook_ray_s(row, col) : yield from ray(row, col, - 1, 0) def rook_ray_e(row, col) : yield from ray(row, col, 0, 1) def rook_ray_w(row, col) : yield from ray(row, col, 0, - 1)
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             class Declaration : def __init__(self, t, name, definition) : self.t = t self.name = name self.definition = definition
+def black_pawn_captures(row, col):
+    if is_valid(row - 1, col - 1):
+        yield row - 1, col - 1
+    if is_valid(row - 1, col + 1):
+        yield row - 1, col + 1
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                              def as_decl(self) : i = self.t.index('[') if i> 0 : return f 'extern const {self.t[:i]} {self.name}{self.t[i:]};' else : return f 'extern const {self.t} {self.name};'
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                          def as_def(self) : return self.as_decl()[ : - 1].replace('extern', '') + ' = ' + self.definition + ';'
+def king_moves(row, col):
+    for drow in [-1, 0, 1]:
+        for dcol in [-1, 0, 1]:
+            if (drow, dcol) != (0, 0) and is_valid(row + drow, col + dcol):
+                yield (row + drow, col + dcol)
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   def define_struct(row, col)->str : return '{' + bboard_hex(row, col) + ',' + sq88(row, col) + '}'
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     def make_array(name, movegen)->Declaration : s = '{\n' for row in range(8) : for col in range(8) : bboard = 0 for r, c in movegen(row, col) : bboard = bboard |(1 <<(r * 8 + c)) s += f '  /*{coord(row, col)}*/ {hex(bboard)}UL,' + '\n' s += '}' return Declaration('uint64_t[64]', name, s)
+def ray(row, col, drow, dcol):
+    row = row + drow
+    col = col + dcol
+    while is_valid(row, col):
+        yield row, col
+        row = row + drow
+        col = col + dcol
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               def make_list_of_moves(name, movegen)->Declaration : s = '{\n' for row in range(8) : for col in range(8) : items = list(map(lambda x : define_struct(* x), movegen(row, col))) while len(items)<8 : items.append('{0,0x88}') array = '{' + ','.join(items) + '},\n' s += f '  /*{coord(row, col)}*/ ' + array s += '}' return Declaration('bboard_and_square_t[64][8]', name, s)
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             declarations =[make_array('KING_CAPTURES', king_moves), make_list_of_moves('KING_MOVES', king_moves), make_array('KNIGHT_CAPTURES', knight_moves), make_list_of_moves('KNIGHT_MOVES', knight_moves), make_array('WHITE_PAWN_CAPTURES', white_pawn_captures), make_array('BLACK_PAWN_CAPTURES', black_pawn_captures), make_list_of_moves('BISHOP_RAY_NE', bishop_ray_ne), make_list_of_moves('BISHOP_RAY_SE', bishop_ray_se), make_list_of_moves('BISHOP_RAY_NW', bishop_ray_nw), make_list_of_moves('BISHOP_RAY_SW', bishop_ray_sw), make_list_of_moves('ROOK_RAY_N', rook_ray_n), make_list_of_moves('ROOK_RAY_S', rook_ray_s), make_list_of_moves('ROOK_RAY_E', rook_ray_e), make_list_of_moves('ROOK_RAY_W', rook_ray_w), ]
+def bishop_ray_ne(row, col):
+    yield from ray(row, col, 1, 1)
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 generated_file_disclaimer = "// This is file is generated automatically, should not be edited manually\n"
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 h_pre = generated_file_disclaimer + ""
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     "
+def bishop_ray_se(row, col):
+    yield from ray(row, col, -1, 1)
+
+
+def bishop_ray_nw(row, col):
+    yield from ray(row, col, 1, -1)
+
+
+def bishop_ray_sw(row, col):
+    yield from ray(row, col, -1, -1)
+
+
+def rook_ray_n(row, col):
+    yield from ray(row, col, 1, 0)
+
+
+def rook_ray_s(row, col):
+    yield from ray(row, col, -1, 0)
+
+
+def rook_ray_e(row, col):
+    yield from ray(row, col, 0, 1)
+
+
+def rook_ray_w(row, col):
+    yield from ray(row, col, 0, -1)
+
+
+ROOK_DIRECTIONS = [(1, 0), (-1, 0), (0, 1), (0, -1)]
+
+BISHOP_DIRECTIONS = [(1, 1), (-1, 1), (1, -1), (-1, -1)]
+
+
+def slider_mask(row, col, directions):
+    """squares whose occupancy matters for a slider : the rays, without the
+    last square of each ray"""
+    mask = 0
+    for drow, dcol in directions:
+        squares = list(ray(row, col, drow, dcol))
+        for r, c in squares[:-1]:
+            mask |= 1 << (r * 8 + c)
+    return mask
+
+
+def slider_attack(row, col, directions, occupied):
+    attack = 0
+    for drow, dcol in directions:
+        for r, c in ray(row, col, drow, dcol):
+            attack |= 1 << (r * 8 + c)
+            if occupied & (1 << (r * 8 + c)):
+                break
+    return attack
+
+
+def subsets(mask):
+    """all the subsets of mask (carry-rippler)"""
+    subset = 0
+    while True:
+        yield subset
+        subset = (subset - mask) & mask
+        if subset == 0:
+            break
+
+
+def find_magic(row, col, directions, rng):
+    mask = slider_mask(row, col, directions)
+    bits = bin(mask).count('1')
+    shift = 64 - bits
+    occupancies = list(subsets(mask))
+    attacks = [slider_attack(row, col, directions, o) for o in occupancies]
+    full = (1 << 64) - 1
+    while True:
+        magic = rng.getrandbits(64) & rng.getrandbits(64) & rng.getrandbits(64)
+        if bin(((mask * magic) & full) >> 56).count('1') < 6:
+            continue
+        used = {}
+        for occupancy, attack in zip(occupancies, attacks):
+            index = ((occupancy * magic) & full) >> shift
+            if used.setdefault(index, attack) != attack:
+                break
+        else:
+            return mask, magic, shift
+
+
+def make_magics(prefix, directions, rng):
+    masks = '{\n'
+    magics = '{\n'
+    shifts = '{\n'
+    offsets = '{\n'
+    offset = 0
+    for row in range(8):
+        for col in range(8):
+            mask, magic, shift = find_magic(row, col, directions, rng)
+            masks += f'  /*{coord(row, col)}*/ {hex(mask)}UL,' + '\n'
+            magics += f'  /*{coord(row, col)}*/ {hex(magic)}UL,' + '\n'
+            shifts += f'  /*{coord(row, col)}*/ {shift},' + '\n'
+            offsets += f'  /*{coord(row, col)}*/ {offset},' + '\n'
+            offset += 1 << (64 - shift)
+    return [
+        Declaration('uint64_t[64]', prefix + '_MASKS', masks + '}'),
+        Declaration('uint64_t[64]', prefix + '_MAGICS', magics + '}'),
+        Declaration('uint8_t[64]', prefix + '_SHIFTS', shifts + '}'),
+        Declaration('uint32_t[64]', prefix + '_OFFSETS', offsets + '}'),
+        Define(prefix + '_ATTACKS_SIZE', str(offset)),
+    ]
+
+
+class Declaration:
+
+    def __init__(self, t, name, definition):
+        self.t = t
+        self.name = name
+        self.definition = definition
+
+    def as_decl(self):
+        i = self.t.find('[')
+        if i > 0:
+            return f'extern const {self.t[:i]} {self.name}{self.t[i:]};'
+        else:
+            return f'extern const {self.t} {self.name};'
+
+    def as_def(self):
+        return self.as_decl()[:-1].replace('extern ', '') + ' = ' + \
+            self.definition + ';'
+
+
+class Define:
+    """compile time constant, only written in the header"""
+
+    def __init__(self, name, value):
+        self.name = name
+        self.value = value
+
+    def as_decl(self):
+        return f'#define {self.name} {self.value}'
+
+    def as_def(self):
+        return ''
+
+
+def make_array(name, movegen) -> Declaration:
+    s = '{\n'
+    for row in range(8):
+        for col in range(8):
+            bboard = 0
+            for r, c in movegen(row, col):
+                bboard = bboard | (1 << (r * 8 + c))
+            s += f'  /*{coord(row, col)}*/ {hex(bboard)}UL,' + '\n'
+    s += '}'
+    return Declaration('uint64_t[64]', name, s)
+
+
+def make_list_of_moves(name, movegen) -> Declaration:
+    """the squares reached by movegen, one bitboard each, 0 terminated"""
+    s = '{\n'
+    for row in range(8):
+        for col in range(8):
+            items = list(map(lambda x: bboard_hex(*x), movegen(row, col)))
+            while len(items) < 8:
+                items.append('0')
+            array = '{' + ','.join(items) + '},\n'
+            s += f'  /*{coord(row, col)}*/ ' + array
+    s += '}'
+    return Declaration('uint64_t[64][8]', name, s)
+
+
+# fixed seed, so that the magics are the same each time the file is generated
+rng = random.Random(0x5eb3e27)
+
+declarations = [
+    make_array('KING_CAPTURES', king_moves),
+    make_array('KNIGHT_CAPTURES', knight_moves),
+    make_array('WHITE_PAWN_CAPTURES', white_pawn_captures),
+    make_array('BLACK_PAWN_CAPTURES', black_pawn_captures),
+    make_list_of_moves('BISHOP_RAY_NE', bishop_ray_ne),
+    make_list_of_moves('BISHOP_RAY_SE', bishop_ray_se),
+    make_list_of_moves('BISHOP_RAY_NW', bishop_ray_nw),
+    make_list_of_moves('BISHOP_RAY_SW', bishop_ray_sw),
+    make_list_of_moves('ROOK_RAY_N', rook_ray_n),
+    make_list_of_moves('ROOK_RAY_S', rook_ray_s),
+    make_list_of_moves('ROOK_RAY_E', rook_ray_e),
+    make_list_of_moves('ROOK_RAY_W', rook_ray_w),
+] + make_magics('ROOK', ROOK_DIRECTIONS, rng) + \
+    make_magics('BISHOP', BISHOP_DIRECTIONS, rng)
+
+generated_file_disclaimer = "// This is file is generated automatically, should not be edited manually\n"
+
+h_pre = generated_file_disclaimer + """
 #ifndef BoardState_constants_HPP
 #define BoardState_constants_HPP
 
 #include <stdint.h>
 
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 extern "C" {
+extern "C" {
 
-  struct bboard_and_square_t {
-    uint64_t bboard;
-    uint8_t square;
-  };
-
-  ""
-  "
+"""
 
-      h_post = ""
-               "
+h_post = """
 } // end-of extern "C"
 
 #endif
-""
-    "
+"""
 
-    cpp_pre = generated_file_disclaimer + ""
-                                          "
+cpp_pre = generated_file_disclaimer + """
 #include "BoardState_constants.hpp"
-              extern "C" {
-  ""
-  "
+extern "C" {
+"""
 
-      cpp_post = ""
-                 "
+cpp_post = """
 } // end-of extern "C"
 """
 
 if __name__ == '__main__':
     filename = 'BoardState_constants'
-
     with open(filename + '.hpp', 'w') as out:
-        out.write(h_pre) 
+        out.write(h_pre)
         for d in declarations:
             out.write(d.as_decl())
             out.write('\n')
-        out.write(h_post) 
-    
+        out.write(h_post)
     with open(filename + '.cpp', 'w') as out:
-        out.write(cpp_pre) 
+        out.write(cpp_pre)
         for d in declarations:
-            out.write(d.as_def())
-            out.write('\n')
-        out.write(cpp_post)
\ No newline at end of file
+            if d.as_def():
+                out.write(d.as_def())
+                out.write('\n')
+        out.write(cpp_post)
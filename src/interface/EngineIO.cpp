@@ -4,7 +4,7 @@
 
 namespace siegbert {
 
-EngineIO::EngineIO() { interface = new UciInterface(this); }
+EngineIO::EngineIO() : out_(nullptr) { interface = new UciInterface(this); }
 
 EngineIO::~EngineIO() { delete interface; }
 
@@ -31,6 +31,7 @@ void EngineIO::run(std::istream &in, std::ostream &out) {
 }
 
 void EngineIO::send(const std::string &line) {
+  std::lock_guard<std::mutex> lock(send_mutex);
   if (out_) {
     (*out_) << line << std::endl;
   }
@@ -3,6 +3,7 @@
 #define EngineIO_HPP
 
 #include <iostream>
+#include <mutex>
 #include <string>
 
 #include "interface/EngineInterface.hpp"
@@ -16,6 +17,9 @@ private:
 
   std::ostream *out_;
 
+  /* the searches send their results from their own thread */
+  std::mutex send_mutex;
+
 public:
   EngineIO();
 
@@ -23,6 +27,7 @@ public:
 
   void run(std::istream &in, std::ostream &out);
 
+  /** writes a line, may be called from any thread */
   void send(const std::string &line);
 };
 } // namespace siegbert
@@ -1,26 +1,41 @@
 
+#include <algorithm>
 #include <regex>
+#include <sstream>
+#include <thread>
 using namespace std;
 
+#include "game/Perft.hpp"
 #include "interface/UciInterface.hpp"
 #include "utils/StringUtils.hpp"
 
 namespace siegbert {
 
-UciInterface::UciInterface(EngineIO *io_) : io(io_) {
+UciInterface::UciInterface(EngineIO *io_) : io(io_), stop_requested(false) {
 
   handlers["uci"] = [this] {
     io->send("id name siegbert");
     io->send("id author Julien Rialland <julien.rialland@gmail.com>");
     io->send("option name OwnBook type check default true");
+    io->send("option name Threads type spin default 1 min 1 max " +
+             to_string(Evaluator::MAX_THREADS));
+    io->send("option name Hash type spin default 16 min 1 max 65536");
     io->send("uciok");
   };
 
   handlers["isready"] = [this] { io->send("readyok"); };
 
-  handlers["quit"] = [this] { exit_required_ = true; };
+  handlers["stop"] = [this] { stop_search(); };
 
-  handlers["ucinewgame"] = [this] { boardState = BoardState::initial(); };
+  handlers["quit"] = [this] {
+    stop_search();
+    exit_required_ = true;
+  };
+
+  handlers["ucinewgame"] = [this] {
+    wait_search();
+    boardState = BoardState::initial();
+  };
 
   handlers["ponderhit"] = [this] {
     // TODO
@@ -30,7 +45,20 @@ UciInterface::UciInterface(EngineIO *io_) : io(io_) {
 static const std::regex re_setoption("^setoption name (.+) value (.+)");
 static const std::regex re_register("^register (.+)$");
 static const std::regex re_position("^position (.+)$");
-static const std::regex re_go("^go( .*)$");
+static const std::regex re_go("^go( .*)?$");
+
+UciInterface::~UciInterface() { stop_search(); }
+
+void UciInterface::wait_search() {
+  if (search_thread.joinable()) {
+    search_thread.join();
+  }
+}
+
+void UciInterface::stop_search() {
+  stop_requested.store(true);
+  wait_search();
+}
 
 void UciInterface::receive(const string &line) {
 
@@ -40,6 +68,9 @@ void UciInterface::receive(const string &line) {
     return;
   }
 
+  // the other commands change the position or the options
+  wait_search();
+
   std::cmatch m;
 
   // setoption xxx yyyy
@@ -81,13 +112,33 @@ void UciInterface::receive(const string &line) {
   }
 
   if (std::regex_match(line.c_str(), m, re_go)) {
-    string params;
-    params.assign(m[1].first, m[1].second);
+    const string params = m[1].str();
     vector<string> parts = StringUtils::split(params, ' ');
-    for (int i = 0; i < parts.size(); i += 1) {
-      // TODO
+    int depth = Negamax::MAX_PLY - 1;
+    int movetime_ms = 0;
+    int time_left = 0, increment = 0, movestogo = 30;
+    bool white = boardState.is_white_to_move();
+    for (size_t i = 0; i + 1 < parts.size(); i += 1) {
+      const string &key = parts[i];
+      if (key.compare("perft") == 0) {
+        perft(stoi(parts[i + 1]));
+        return;
+      } else if (key.compare("depth") == 0) {
+        depth = stoi(parts[i + 1]);
+      } else if (key.compare("movetime") == 0) {
+        movetime_ms = stoi(parts[i + 1]);
+      } else if (key.compare(white ? "wtime" : "btime") == 0) {
+        time_left = stoi(parts[i + 1]);
+      } else if (key.compare(white ? "winc" : "binc") == 0) {
+        increment = stoi(parts[i + 1]);
+      } else if (key.compare("movestogo") == 0) {
+        movestogo = max(1, stoi(parts[i + 1]));
+      }
     }
-    go();
+    if (movetime_ms == 0 && time_left > 0) {
+      movetime_ms = max(1, time_left / movestogo + increment / 2);
+    }
+    go(depth, movetime_ms);
     return;
   }
 
@@ -108,7 +159,47 @@ void UciInterface::set_position(const string &pos,
   }
 }
 
-void UciInterface::set_option(const string &key, const string &value) {}
+void UciInterface::set_option(const string &key, const string &value) {
+  if (key.compare("Threads") == 0) {
+    evaluator.set_threads(stoi(value));
+  } else if (key.compare("Hash") == 0) {
+    evaluator.set_hash(max(1, stoi(value)));
+  }
+}
+
+void UciInterface::perft(int depth) {
+  io->send(perft_divide(boardState, depth, evaluator.get_threads()).to_str());
+}
+
+void UciInterface::go(int depth, int movetime_ms) {
+  wait_search();
+  stop_requested.store(false);
+  search_thread = thread([this, depth, movetime_ms, bs = boardState]() mutable {
+    SearchResult result =
+        evaluator.search(bs, depth, movetime_ms, &stop_requested);
+    send_result(result);
+  });
+}
+
+void UciInterface::send_result(const SearchResult &result) {
+  if (result.pv.empty()) {
+    io->send("bestmove 0000");
+    return;
+  }
 
-void UciInterface::go() {}
+  ostringstream info;
+  info << "info depth " << result.depth;
+  if (abs(result.score) > Negamax::MATE_SCORE - Negamax::MAX_PLY) {
+    int plies = Negamax::MATE_SCORE - abs(result.score);
+    info << " score mate " << (result.score > 0 ? 1 : -1) * (plies + 1) / 2;
+  } else {
+    info << " score cp " << result.score;
+  }
+  info << " nodes " << result.nodes << " pv";
+  for (auto &move : result.pv) {
+    info << ' ' << move.to_str();
+  }
+  io->send(info.str());
+  io->send("bestmove " + result.best_move.to_str());
+}
 } // namespace siegbert
\ No newline at end of file
@@ -5,8 +5,10 @@
 #include "interface/EngineIO.hpp"
 #include "interface/EngineInterface.hpp"
 
+#include <atomic>
 #include <functional>
 #include <map>
+#include <thread>
 
 namespace siegbert {
 
@@ -19,17 +21,37 @@ private:
 
   std::map<std::string, std::function<void()>> handlers;
 
+  /* "go" searches in this thread, so that "stop" can still be received */
+  std::thread search_thread;
+
+  std::atomic<bool> stop_requested;
+
   void set_option(const std::string &key, const std::string &value);
 
+  /** sends the info line and the bestmove */
+  void send_result(const SearchResult &result);
+
+  /** waits for the search in progress, if any, to send its bestmove */
+  void wait_search();
+
+  /** interrupts the search in progress, if any, and waits for its bestmove */
+  void stop_search();
+
 public:
   UciInterface(EngineIO *io);
 
+  ~UciInterface() override;
+
   void receive(const std::string &line) override;
 
   void set_position(const std::string &pos,
                     const std::vector<std::string> &moves);
 
-  void go();
+  /** starts the search, bestmove is sent once it is over */
+  void go(int depth, int movetime_ms);
+
+  /** "go perft N" : leaf nodes count below each root move, and in total */
+  void perft(int depth);
 };
 } // namespace siegbert
 
@@ -22,6 +22,7 @@ XBoardInterface::XBoardInterface(EngineIO *io) {
     engineIO->send("feature debug=1");
     engineIO->send("feature time=0");
     engineIO->send("feature playother=0");
+    engineIO->send("feature smp=1");
     engineIO->send("feature done=1");
   };
 
@@ -59,6 +60,8 @@ XBoardInterface::XBoardInterface(EngineIO *io) {
 static const std::regex re_move("^[a-h][1-8][a-h][1-8][nbrq]?$");
 static const std::regex re_ping("^ping ([0-9a-z]+)$");
 static const std::regex re_setboard("^setboard (.+)$");
+static const std::regex re_st("^st ([0-9]+)$");
+static const std::regex re_cores("^cores ([0-9]+)$");
 
 void XBoardInterface::receive(const std::string &line) {
   auto it = handlers.find(line);
@@ -93,15 +96,31 @@ void XBoardInterface::receive(const std::string &line) {
     boardstate = BoardState::from_fen(fen);
     history.clear();
   }
+
+  else if (regex_match(line.c_str(), m, re_st)) {
+    std::string val;
+    val.assign(m[1].first, m[1].second);
+    movetime_ms = std::stoi(val) * 1000;
+  }
+
+  else if (regex_match(line.c_str(), m, re_cores)) {
+    std::string val;
+    val.assign(m[1].first, m[1].second);
+    evaluator.set_threads(std::stoi(val));
+  }
 }
 
 void XBoardInterface::play() {
-  std::string move = evaluator.eval(boardstate, 5);
+  std::string move =
+      evaluator.eval(boardstate, Negamax::MAX_PLY - 1, movetime_ms);
   if (move.compare("resign") == 0) {
     engineIO->send("resign");
   } else {
     engineIO->send("move " + move);
-    boardstate.make_move(boardstate.get_move(move));
+    Memento memento = boardstate.memento();
+    Move m = boardstate.get_move(move);
+    history.push_back(std::make_pair(m, memento));
+    boardstate.make_move(m);
   }
 }
 
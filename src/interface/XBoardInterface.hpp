@@ -16,6 +16,9 @@ class XBoardInterface : public EngineInterface {
 private:
   bool force = false;
 
+  /** time allowed for each move, can be changed using the "st" command */
+  int movetime_ms = 5000;
+
   std::vector<std::pair<Move, Memento>> history;
 
   std::map<std::string, std::function<void()>> handlers;
@@ -1,11 +1,39 @@
-
+#include "game/Perft.hpp"
 #include "interface/EngineIO.hpp"
+#include <cstring>
 #include <iostream>
 
 using namespace siegbert;
 
+/* siegbert perft DEPTH [fen FEN] [threads N] [hash MB] */
+static int run_perft(int argc, char **argv) {
+  int depth = argc > 2 ? atoi(argv[2]) : 1;
+  BoardState boardState = BoardState::initial();
+  int n_threads = 0;
+  size_t hash_megabytes = 16;
+  for (int i = 3; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "fen") == 0) {
+      boardState = BoardState::from_fen(argv[i + 1]);
+    } else if (strcmp(argv[i], "threads") == 0) {
+      n_threads = atoi(argv[i + 1]);
+    } else if (strcmp(argv[i], "hash") == 0) {
+      hash_megabytes = atoi(argv[i + 1]);
+    } else {
+      std::cerr << "unknown perft option " << argv[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  std::cout << perft_divide(boardState, depth, n_threads, hash_megabytes)
+                   .to_str()
+            << std::endl;
+  return EXIT_SUCCESS;
+}
+
 int main(int argc, char **argv) {
+  if (argc > 1 && strcmp(argv[1], "perft") == 0) {
+    return run_perft(argc, argv);
+  }
   EngineIO engineIO;
   engineIO.run(std::cin, std::cout);
   return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
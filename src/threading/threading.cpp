@@ -4,7 +4,7 @@
 
 namespace siegbert {
 
-ThreadPool::ThreadPool(int n_threads_) {
+ThreadPool::ThreadPool(int n_threads_) : done(false) {
   if (n_threads_ < 1) {
     n_threads_ = std::max(1u, std::thread::hardware_concurrency());
   }
@@ -29,6 +29,10 @@ ThreadPool::~ThreadPool() {
     std::unique_lock<std::mutex> lock(guard);
     done = true;
   } while (0);
+  /* wake up the idle workers, so that they notice it is over */
+  for (size_t i = 0; i < threads.size(); i++) {
+    pending.push([](void) -> void {});
+  }
   for (auto &t : threads) {
     t.join();
   }
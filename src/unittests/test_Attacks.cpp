@@ -0,0 +1,32 @@
+#include <catch.hpp>
+
+#include "game/Attacks.hpp"
+
+#include <random>
+
+using namespace siegbert;
+
+TEST_CASE("sliding attacks match the rays", "[Attacks][smoke_test]") {
+  std::mt19937_64 rng(0x5eb3e27);
+  for (int offset = 0; offset < 64; offset += 1) {
+    for (int i = 0; i < 1000; i += 1) {
+      // sparse and dense occupancies
+      uint64_t occupied = rng() & rng();
+      if (i & 1) {
+        occupied |= rng();
+      }
+      REQUIRE(rook_attacks(offset, occupied) ==
+              rook_attacks_rays(offset, occupied));
+      REQUIRE(bishop_attacks(offset, occupied) ==
+              bishop_attacks_rays(offset, occupied));
+    }
+  }
+}
+
+TEST_CASE("pop_lsb", "[Attacks][smoke_test]") {
+  uint64_t bboard = 0x8000000000000101UL;
+  REQUIRE(pop_lsb(bboard) == 0);
+  REQUIRE(pop_lsb(bboard) == 8);
+  REQUIRE(pop_lsb(bboard) == 63);
+  REQUIRE(bboard == 0);
+}
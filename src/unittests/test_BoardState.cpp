@@ -5,6 +5,7 @@
 #include "pgn/Pgn.hpp"
 
 #include <fstream>
+#include <functional>
 
 using namespace std;
 using namespace siegbert;
@@ -39,6 +40,38 @@ TEST_CASE("xboard promotion", "[BoardState][smoke_test]") {
   Move m = b.get_move("g2g1n");
 }
 
+TEST_CASE("move notations", "[BoardState][smoke_test]") {
+  // two knights can go to d2, two rooks to a3
+  auto b =
+      BoardState::from_fen("r3k2r/1P6/8/8/R7/1N6/4P3/R3KN2 w Qkq - 0 1");
+  REQUIRE(b.get_move("Nbd2").from == SQUARE(2, 1));
+  REQUIRE(b.get_move("Nfd2").from == SQUARE(0, 5));
+  REQUIRE(b.get_move("Nf1-e3").to == SQUARE(2, 4));
+  REQUIRE(b.get_move("R1a3").from == SQUARE(0, 0));
+  REQUIRE(b.get_move("R4a3!?").from == SQUARE(3, 0));
+  REQUIRE(b.get_move("e4").pawn_jumstart);
+  REQUIRE(b.get_move("O-O-O").queenside_castling);
+  REQUIRE(b.get_move("0-0-0").queenside_castling);
+  REQUIRE(b.get_move("e1c1").queenside_castling);
+  for (auto &san : {"bxa8=N+", "bxa8N", "b7a8n"}) {
+    const Move move = b.get_move(san);
+    REQUIRE(move.captured == 'r');
+    REQUIRE(move.promotion == 'n');
+  }
+  REQUIRE(b.get_move("b8=Q").promotion == 'q');
+  REQUIRE(b.get_move("b7b8").promotion == 'q');
+
+  // ambiguous : the first matching move is returned
+  REQUIRE(b.get_move("Nd2").piece == 'n');
+
+  // illegal or malformed
+  for (auto &san : {"O-O", "Ke3", "bxa8", "exd3", "Rxa3", "Zf3", "e9", "",
+                    "e2e4e", "Nf1?e3"}) {
+    INFO(san);
+    REQUIRE_THROWS_AS(b.get_move(san), invalid_argument);
+  }
+}
+
 TEST_CASE("king legal moves", "[BoardState][smoke_test]") {
   auto b = BoardState::from_fen("7q/7K/8/8/8/8/8/k7 w - - 0 1");
   BoardState saved(b);
@@ -63,6 +96,33 @@ TEST_CASE("king moves when in check", "[BoardState][smoke_test]") {
   REQUIRE(moves[0].to == SQUARE(4, 4));
 }
 
+TEST_CASE("king moves along a checking ray", "[BoardState][smoke_test]") {
+  // the king cannot escape to b1 or d1 : the rook still attacks them
+  auto b = BoardState::from_fen("4k3/8/8/8/8/8/8/2K4r w - - 0 1");
+  REQUIRE(b.is_check());
+  auto moves = b.generate_moves();
+  REQUIRE(moves.size() == 3);
+  for (auto &move : moves) {
+    REQUIRE(ROW(move.to) == 1);
+  }
+}
+
+TEST_CASE("attackers", "[BoardState][smoke_test]") {
+  auto b = BoardState::from_fen(
+      "r1bqkbnr/pppp1ppp/2n5/4p3/3PP3/5N2/PPP2PPP/RNBQKB1R b KQkq - 0 3");
+  const uint64_t occupied = b.white.presence | b.black.presence;
+  // e5 is attacked by the pawn on d4 and the knight on f3
+  REQUIRE(b.white.attackers_to(SQUARE(4, 4), occupied, true) ==
+          (BBOARD(SQUARE(3, 3)) | BBOARD(SQUARE(2, 5))));
+  // d4 is attacked by the pawn on e5 and the knight on c6
+  REQUIRE(b.black.attackers_to(SQUARE(3, 3), occupied, false) ==
+          (BBOARD(SQUARE(4, 4)) | BBOARD(SQUARE(5, 2))));
+  // ... and defended by the queen on d1 and the knight on f3
+  REQUIRE(b.white.attackers_to(SQUARE(3, 3), occupied, true) ==
+          (BBOARD(SQUARE(0, 3)) | BBOARD(SQUARE(2, 5))));
+  REQUIRE(!b.is_check());
+}
+
 TEST_CASE("pinned bishop", "[BoardState][smoke_test]") {
   auto b = BoardState::from_fen(
       "rn1qk1nr/ppppbppp/8/8/8/8/PPPPQPPP/RNB1KBNR b KQkq - 0 1");
@@ -74,6 +134,113 @@ TEST_CASE("pinned bishop", "[BoardState][smoke_test]") {
   }
 }
 
+TEST_CASE("checkers and pinned pieces", "[BoardState][smoke_test]") {
+  // the bishop on e7 is pinned by the queen, the knight on d6 gives check
+  auto b = BoardState::from_fen("4k3/4b3/3N4/8/8/8/8/4Q1K1 b - - 0 1");
+  REQUIRE(b.checkers() == BBOARD(SQUARE(5, 3)));
+  REQUIRE(b.pinned() == BBOARD(SQUARE(6, 4)));
+  // the king must move, or the knight must be taken : the bishop cannot
+  auto moves = b.generate_legal_moves();
+  for (auto &move : moves) {
+    REQUIRE(move.piece == 'k');
+  }
+  REQUIRE(moves.size() == 3); // d7, d8 and f8
+}
+
+TEST_CASE("captures and quiets", "[BoardState][smoke_test]") {
+  for (auto fen :
+       {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+        "2r3k1/8/1p5B/pP1P2P1/PbN4p/7P/1R1PR1p1/8 b - - 0 1"}) {
+    auto b = BoardState::from_fen(fen);
+    MoveList captures, quiets;
+    b.generate_captures(captures);
+    b.generate_quiets(quiets);
+    for (auto &move : captures) {
+      REQUIRE((move.captured || move.promotion));
+    }
+    for (auto &move : quiets) {
+      REQUIRE(!move.captured);
+      REQUIRE(!move.promotion);
+    }
+    REQUIRE(captures.size() + quiets.size() == b.generate_legal_moves().size());
+  }
+}
+
+TEST_CASE("enpassant exposing the king", "[BoardState][smoke_test]") {
+  // both pawns leave the 5th rank : the rook would give check
+  auto b = BoardState::from_fen("8/8/8/K2pP2r/8/8/8/4k3 w - d6 0 1");
+  for (auto &move : b.generate_legal_moves()) {
+    REQUIRE(!move.enpassant);
+  }
+  int pseudo_legal_enpassant = 0;
+  for (auto &move : b.generate_moves()) {
+    pseudo_legal_enpassant += move.enpassant;
+  }
+  REQUIRE(pseudo_legal_enpassant == 1);
+}
+
+static void require_mailbox(const State &state) {
+  uint64_t all = 0;
+  for (char piece : {'p', 'n', 'b', 'r', 'q', 'k'}) {
+    const uint64_t bboard = state.bitboard(piece);
+    // a square holds at most one kind of piece
+    REQUIRE(!(all & bboard));
+    all |= bboard;
+    for (int offset = 0; offset < 64; offset += 1) {
+      const bool here = (bboard >> offset) & 1;
+      REQUIRE(here == (state.board[offset] == piece));
+    }
+  }
+  REQUIRE(all == state.presence);
+  for (int offset = 0; offset < 64; offset += 1) {
+    REQUIRE(((all >> offset) & 1) == (state.board[offset] != '\0'));
+  }
+}
+
+/* plays every legal move of the positions, and every reply to it. check is
+ * called on each position reached, after each make and after each unmake,
+ * with the move and the memento of the position it is played from */
+static void for_each_move_and_reply(
+    const vector<string> &fens,
+    const function<void(const BoardState &, const Move &, const Memento &)>
+        &check) {
+  for (auto &fen : fens) {
+    auto b = BoardState::from_fen(fen);
+    const Memento memento = b.memento();
+    for (auto &move : b.generate_legal_moves()) {
+      b.make_legal_move(move);
+      check(b, move, memento);
+      const Memento memento2 = b.memento();
+      for (auto &reply : b.generate_legal_moves()) {
+        b.make_legal_move(reply);
+        check(b, reply, memento2);
+        b.unmake_move(reply, memento2);
+        check(b, reply, memento2);
+        REQUIRE(b.get_zobrist_hash() == memento2.z);
+      }
+      b.unmake_move(move, memento);
+      check(b, move, memento);
+      REQUIRE(b.get_zobrist_hash() == memento.z);
+    }
+    REQUIRE(b.to_fen() == fen);
+  }
+}
+
+// castlings, enpassant, promotions and captures of all kinds
+static const vector<string> walked_fens = {
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3"};
+
+TEST_CASE("mailbox", "[BoardState][smoke_test]") {
+  for_each_move_and_reply(
+      walked_fens, [](const BoardState &b, const Move &, const Memento &) {
+        require_mailbox(b.white);
+        require_mailbox(b.black);
+      });
+}
+
 TEST_CASE("legal moves", "[BoardState][smoke_test]") {
   auto b = BoardState::from_fen(
       "1N5Q/2p1p1bk/2p2Rb1/8/1P4np/6pP/4K1P1/6R1 b - - 0 1");
@@ -167,6 +334,163 @@ TEST_CASE("zobrist", "[BoardState]") {
   }
 }
 
+static void require_same_keys(const BoardState &b) {
+  auto fresh = BoardState::from_fen(b.to_fen());
+  REQUIRE(b.get_zobrist_hash() == fresh.get_zobrist_hash());
+  REQUIRE(b.get_pawn_key() == fresh.get_pawn_key());
+  REQUIRE(b.get_material_key() == fresh.get_material_key());
+}
+
+TEST_CASE("pawn and material keys", "[BoardState][smoke_test]") {
+  for_each_move_and_reply(
+      walked_fens,
+      [](const BoardState &b, const Move &move, const Memento &memento) {
+        require_same_keys(b);
+        if (move.piece != 'p' && move.piece != 'k' && !move.captured) {
+          REQUIRE(b.get_pawn_key() == memento.pawn_key);
+        }
+        if (!move.captured && !move.promotion) {
+          REQUIRE(b.get_material_key() == memento.material_key);
+        }
+      });
+
+  // the material key only depends on the number of pieces of each kind
+  REQUIRE(BoardState::from_fen("4k3/p7/8/8/8/8/3N4/4K3 w - - 0 1")
+              .get_material_key() ==
+          BoardState::from_fen("8/5k2/8/2p5/8/N7/8/K7 b - - 0 1")
+              .get_material_key());
+  REQUIRE(BoardState::from_fen("4k3/p7/8/8/8/8/3N4/4K3 w - - 0 1")
+              .get_material_key() !=
+          BoardState::from_fen("4k3/p7/8/8/8/8/3B4/4K3 w - - 0 1")
+              .get_material_key());
+
+  // the material keys are not the piece-square keys : "one white knight" does
+  // not hash like "a white knight on a1"
+  auto knight = BoardState::from_fen("4k3/8/8/8/8/8/8/N3K3 w - - 0 1");
+  REQUIRE((knight.get_zobrist_hash() ^ knight.get_material_key()) !=
+          BoardState::from_fen("4k3/8/8/8/8/8/8/4K3 w - - 0 1")
+              .get_zobrist_hash());
+}
+
+static void require_same_psq(const BoardState &b) {
+  auto fresh = BoardState::from_fen(b.to_fen());
+  REQUIRE(b.psq_score() == fresh.psq_score());
+  REQUIRE(b.white.mg == fresh.white.mg);
+  REQUIRE(b.white.eg == fresh.white.eg);
+  REQUIRE(b.white.phase == fresh.white.phase);
+  REQUIRE(b.black.mg == fresh.black.mg);
+  REQUIRE(b.black.eg == fresh.black.eg);
+  REQUIRE(b.black.phase == fresh.black.phase);
+}
+
+TEST_CASE("piece-square tables", "[BoardState][smoke_test]") {
+  // the initial position is symmetrical
+  auto initial = BoardState::initial();
+  REQUIRE(initial.psq_score() == 0);
+  REQUIRE(initial.white.phase + initial.black.phase == 24);
+
+  // make and unmake keep the values up to date
+  for_each_move_and_reply(
+      walked_fens, [](const BoardState &b, const Move &, const Memento &) {
+        require_same_psq(b);
+      });
+
+  // the same position with the colors swapped
+  auto b = BoardState::from_fen(
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+  auto mirrored = BoardState::from_fen(
+      "r3k2r/pppbbppp/2n2q1P/1P2p3/3pn3/BN2PNP1/P1PPQPB1/R3K2R b KQkq - 0 1");
+  REQUIRE(b.psq_score() != 0);
+  REQUIRE(mirrored.psq_score() == -b.psq_score());
+
+  // a knight in the center is better than in the corner
+  REQUIRE(BoardState::from_fen("4k3/8/8/8/3N4/8/8/4K3 w - - 0 1").psq_score() >
+          BoardState::from_fen("4k3/8/8/8/8/8/8/N3K3 w - - 0 1").psq_score());
+
+  // the bishops are counted as bishops
+  auto count =
+      BoardState::from_fen("2b1kb2/8/8/8/8/8/8/2B1K3 w - - 0 1").count_pieces();
+  REQUIRE(count.white_bishops == 1);
+  REQUIRE(count.black_bishops == 2);
+  REQUIRE(count.white_knights == 0);
+}
+
+TEST_CASE("repetitions", "[BoardState][smoke_test]") {
+  auto b = BoardState::initial();
+  auto play = [&b](const vector<string> &moves) {
+    for (auto &m : moves) {
+      REQUIRE(b.make_move(b.get_move(m)));
+    }
+  };
+  const vector<string> knights = {"g1f3", "g8f6", "f3g1", "f6g8"};
+  play(knights);
+  REQUIRE(b.is_repetition());
+  REQUIRE(!b.is_repetition(2));
+  // for a search started 4 plies ago, this repeats the root : that is not
+  // enough. For a search started earlier, the position is inside the tree
+  REQUIRE(!b.is_repetition(2, 4));
+  REQUIRE(b.is_repetition(2, 5));
+  play(knights);
+  REQUIRE(b.is_repetition(2));
+
+  // unmake goes back in the history
+  const Memento memento = b.memento();
+  Move move = b.get_move("e2e4");
+  b.make_move(move);
+  REQUIRE(!b.is_repetition());
+  b.unmake_move(move, memento);
+  REQUIRE(b.is_repetition(2));
+
+  // a pawn move cannot be undone
+  play({"e2e4", "e7e5"});
+  REQUIRE(!b.is_repetition());
+  play(knights);
+  REQUIRE(b.is_repetition());
+  REQUIRE(!b.is_repetition(2));
+
+  // the positions before a null move are not compared
+  b.make_null_move();
+  play({"g8f6", "g1f3", "f6g8", "f3g1"});
+  REQUIRE(b.is_repetition());
+  b.make_null_move();
+  REQUIRE(!b.is_repetition());
+
+  REQUIRE(!b.is_fifty_moves());
+  REQUIRE(BoardState::from_fen("8/8/3k4/8/8/3K4/8/8 w - - 100 80")
+              .is_fifty_moves());
+}
+
+TEST_CASE("null move", "[BoardState][smoke_test]") {
+  for (auto fen :
+       {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        // the enpassant capture is possible, then it is not
+        "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+        "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1"}) {
+    auto b = BoardState::from_fen(fen);
+    const Memento memento = b.memento();
+    const bool white_to_move = b.is_white_to_move();
+    b.make_null_move();
+    REQUIRE(b.is_white_to_move() != white_to_move);
+    REQUIRE(b.get_enpassant() == 0);
+    // same hash as the position set up from scratch
+    REQUIRE(b.get_zobrist_hash() ==
+            BoardState::from_fen(b.to_fen()).get_zobrist_hash());
+
+    // the moves played after the null move keep the hash consistent
+    const Memento after_null = b.memento();
+    for (auto &move : b.generate_legal_moves()) {
+      b.make_legal_move(move);
+      REQUIRE(b.get_zobrist_hash() ==
+              BoardState::from_fen(b.to_fen()).get_zobrist_hash());
+      b.unmake_move(move, after_null);
+    }
+
+    b.unmake_null_move(memento);
+    REQUIRE(b.to_fen() == fen);
+    REQUIRE(b.get_zobrist_hash() == memento.z);
+  }
+}
+
 TEST_CASE("castling white queenside", "[BoardState][smoke_test]") {
   auto b = BoardState::from_fen(
       "r2nk2r/ppp2p1p/1b6/3Npb2/1P6/P4N2/2P2PPP/R3KB1R w KQkq - 0 13");
@@ -180,6 +504,115 @@ TEST_CASE("castling white queenside", "[BoardState][smoke_test]") {
   REQUIRE(has_castling);
 }
 
+static bool same_move(const Move &a, const Move &b) {
+  return a.from == b.from && a.to == b.to && a.piece == b.piece &&
+         a.captured == b.captured && a.promotion == b.promotion &&
+         a.enpassant == b.enpassant &&
+         a.kingside_castling == b.kingside_castling &&
+         a.queenside_castling == b.queenside_castling &&
+         a.pawn_jumstart == b.pawn_jumstart;
+}
+
+TEST_CASE("packed moves", "[BoardState][smoke_test]") {
+  REQUIRE(sizeof(PackedMove) == 4);
+  vector<string> fens = {
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+      "2r3k1/8/1p5B/pP1P2P1/PbN4p/7P/1R1PR1p1/8 b - - 0 1",
+      "r3k2r/8/8/8/8/8/8/R3K2R b KQkq - 0 1"};
+  for (auto &fen : fens) {
+    auto b = BoardState::from_fen(fen);
+    for (auto &move : b.generate_moves()) {
+      PackedMove packed(move);
+      REQUIRE(same_move(packed.unpack(), move));
+      REQUIRE(packed.to_str() == move.to_str());
+      REQUIRE(packed.to_polyglot(b.white_to_move) ==
+              move.to_polyglot(b.white_to_move));
+      REQUIRE(same_move(b.move_from_short(move.to_short()), move));
+    }
+  }
+}
+
+TEST_CASE("pseudo-legal and legal moves", "[BoardState][smoke_test]") {
+  const vector<string> fens = {
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+      "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+      "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+      "8/8/8/K2pP2r/8/8/8/4k3 w - d6 0 1",
+      "r3k2r/8/8/8/8/8/8/R3K2R b KQkq - 0 1",
+      "r3k2r/8/8/8/8/5n2/8/R3K2R w KQkq - 0 1",
+      "4k3/4b3/3N4/8/8/8/8/4Q1K1 b - - 0 1"};
+  for (auto &fen : fens) {
+    INFO(fen);
+    auto b = BoardState::from_fen(fen);
+    MoveList moves;
+    b.generate_moves(moves);
+    vector<bool> pseudo_legal(1 << 16), legal(1 << 16);
+    for (auto &move : moves) {
+      pseudo_legal[move.to_short()] = true;
+      BoardState copy(b);
+      legal[move.to_short()] = copy.make_move(move);
+      REQUIRE(b.is_pseudo_legal(move));
+      REQUIRE(b.is_legal(move) == legal[move.to_short()]);
+    }
+
+    // every 16 bits code, as it could come from a hash or killer move
+    for (int code = 0; code < (1 << 16); code += 1) {
+      const Move move = b.move_from_short(code);
+      const bool is_pseudo_legal = b.is_pseudo_legal(move);
+      INFO(move.to_str());
+      REQUIRE(is_pseudo_legal == pseudo_legal[code]);
+      REQUIRE((is_pseudo_legal && b.is_legal(move)) == legal[code]);
+    }
+  }
+}
+
+/* gives_check() against make_move() and is_check() */
+void require_gives_check(BoardState &b, int depth) {
+  const CheckInfo info = b.check_info();
+  const Memento memento = b.memento();
+  for (auto &move : b.generate_legal_moves()) {
+    INFO(b.to_fen() << " " << move.to_str());
+    const bool gives_check = b.gives_check(move, info);
+    b.make_legal_move(move);
+    REQUIRE(gives_check == b.is_check());
+    if (depth > 1) {
+      require_gives_check(b, depth - 1);
+    }
+    b.unmake_move(move, memento);
+  }
+}
+
+TEST_CASE("gives check", "[BoardState][smoke_test]") {
+  const vector<pair<string, int>> fens = {
+      {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+       2},
+      {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 2},
+      {"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", 2},
+      {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 3},
+      // castlings
+      {"5k2/8/8/8/8/8/8/4K2R w K - 0 1", 1},
+      {"3k4/8/8/8/8/8/8/R3K3 w Q - 0 1", 1},
+      // discovered by an enpassant capture, or by a knight
+      {"8/8/8/k2pP2R/8/8/8/4K3 w - d6 0 1", 1},
+      {"4k3/8/8/8/4N3/8/8/4R1K1 w - - 0 1", 1},
+      // the promoted piece attacks through the square of the pawn
+      {"3r4/4P3/5k2/8/8/8/8/4K3 w - - 0 1", 1}};
+  for (auto &fen : fens) {
+    auto b = BoardState::from_fen(fen.first);
+    require_gives_check(b, fen.second);
+  }
+
+  auto b = BoardState::from_fen("5k2/8/8/8/8/8/8/4K2R w K - 0 1");
+  REQUIRE(b.gives_check(b.get_move("O-O")));
+  b = BoardState::from_fen("8/8/8/k2pP2R/8/8/8/4K3 w - d6 0 1");
+  REQUIRE(b.gives_check(b.get_move("exd6")));
+  b = BoardState::from_fen("3r4/4P3/5k2/8/8/8/8/4K3 w - - 0 1");
+  REQUIRE(b.gives_check(b.get_move("exd8=Q")));
+  REQUIRE(!b.gives_check(b.get_move("exd8=R")));
+}
+
 void replay_moves(const Pgn &game) {
   auto b = BoardState::initial();
   for (auto &m : game.moves) {
@@ -262,3 +695,156 @@ TEST_CASE("replay_and_unmake", "[BoardState][make_unmake]") {
   LOG_INFO("make/unmake (Carlsen.pgn) :", moves, "moves,", moves * 1000.0 / ms,
            "moves per sec");
 }
+
+TEST_CASE("static exchange evaluation", "[BoardState][smoke_test]") {
+  // an undefended pawn
+  auto b =
+      BoardState::from_fen("1k1r4/1pp4p/p7/4p3/8/P5P1/1PP4P/2K1R3 w - - 0 1");
+  REQUIRE(b.see(b.get_move("e1e5")) == 100);
+
+  // the knight is lost for a pawn, the queen behind the bishop included
+  b = BoardState::from_fen(
+      "1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1");
+  REQUIRE(b.see(b.get_move("d3e5")) == -200);
+  REQUIRE(!b.see_ge(b.get_move("d3e5")));
+  REQUIRE(b.see_ge(b.get_move("d3e5"), -200));
+
+  // the rook behind the rook takes back
+  b = BoardState::from_fen("3rk3/8/8/3r4/8/3R4/3R4/4K3 w - - 0 1");
+  REQUIRE(b.see(b.get_move("d3d5")) == 500);
+  b = BoardState::from_fen("3rk3/8/8/3r4/8/3R4/8/4K3 w - - 0 1");
+  REQUIRE(b.see(b.get_move("d3d5")) == 0);
+
+  // a quiet move to a square attacked by a pawn
+  b = BoardState::from_fen("4k3/8/3p4/8/4N3/8/8/4K3 w - - 0 1");
+  REQUIRE(b.see(b.get_move("e4c5")) == -300);
+  REQUIRE(b.see(b.get_move("e4g5")) == 0);
+
+  // the king can only take back when the square is no longer defended
+  b = BoardState::from_fen("3rk3/8/8/8/8/4K3/3p4/1N6 w - - 0 1");
+  REQUIRE(b.see(b.get_move("b1d2")) == 100);
+  b = BoardState::from_fen("3rk3/3r4/8/8/8/4K3/3p4/1N6 w - - 0 1");
+  REQUIRE(b.see(b.get_move("b1d2")) == -200);
+  REQUIRE(!b.see_ge(b.get_move("b1d2"), -199));
+
+  // see_ge agrees with see
+  const vector<string> fens = {
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+      "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+      "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+      "1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1"};
+  for (auto &fen : fens) {
+    b = BoardState::from_fen(fen);
+    for (auto &move : b.generate_legal_moves()) {
+      const int value = b.see(move);
+      for (int threshold = -1100; threshold <= 1100; threshold += 50) {
+        REQUIRE(b.see_ge(move, threshold) == (value >= threshold));
+      }
+    }
+  }
+}
+
+/* the offset of the unexpected character */
+size_t fen_error_position(const string &fen) {
+  try {
+    BoardState::from_fen(fen);
+  } catch (const FenError &e) {
+    return e.position;
+  }
+  FAIL("no error for " << fen);
+  return 0;
+}
+
+TEST_CASE("fen", "[BoardState][smoke_test]") {
+  const string kiwipete =
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+  REQUIRE(BoardState::from_fen(kiwipete).to_fen() == kiwipete);
+  REQUIRE(BoardState::from_fen("  " + kiwipete + " \r\n").to_fen() ==
+          kiwipete);
+
+  auto b = BoardState::from_fen(
+      "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w Kq f6 0 123");
+  REQUIRE(b.enpassant == BBOARD(SQUARE(5, 5)));
+  REQUIRE(b.white_castling.kingside);
+  REQUIRE(!b.white_castling.queenside);
+  REQUIRE(!b.black_castling.kingside);
+  REQUIRE(b.black_castling.queenside);
+  REQUIRE(b.moves == 123);
+  char buffer[BoardState::MAX_FEN_LENGTH];
+  REQUIRE(string(buffer, b.write_fen(buffer)) == b.to_fen());
+  REQUIRE(string(buffer, b.write_epd(buffer)) ==
+          "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w Kq f6");
+
+  REQUIRE(fen_error_position("") == 0);
+  REQUIRE(fen_error_position("8/8/8/8/8/8/8 w - - 0 1") == 13);
+  REQUIRE(fen_error_position("8/8/8/8/8/8/8/44k w - - 0 1") == 16);
+  REQUIRE(fen_error_position("8/8/8/8/8/8/8/7x w - - 0 1") == 15);
+  REQUIRE(fen_error_position("8/8/8/8/8/8/8/8 x - - 0 1") == 16);
+  REQUIRE(fen_error_position("8/8/8/8/8/8/8/8 w KX - 0 1") == 19);
+  REQUIRE(fen_error_position("8/8/8/8/8/8/8/8 w - e4 0 1") == 21);
+  REQUIRE(fen_error_position("8/8/8/8/8/8/8/8 w - - -1 1") == 22);
+  REQUIRE(fen_error_position("8/8/8/8/8/8/8/8 w - - 0") == 23);
+  REQUIRE(fen_error_position("8/8/8/8/8/8/8/8 w - - 0 1 x") == 26);
+
+  // counts no game can reach
+  REQUIRE(fen_error_position("k7/8/8/8/8/8/8/K6K w - - 0 1") == 17);
+  REQUIRE(fen_error_position("k7/8/8/8/8/P7/PPPPPPPP/K7 w - - 0 1") == 21);
+  REQUIRE(fen_error_position("k7/8/8/8/8/N7/PPPPPPPP/KN5N w - - 0 1") == 26);
+  REQUIRE(fen_error_position("QQQQQQQQ/QQ6/8/8/8/8/8/K6k w - - 0 1") == 10);
+  REQUIRE_NOTHROW(BoardState::from_fen("QQQQQQQQ/Q7/8/8/8/8/8/K6k w - - 0 1"));
+  REQUIRE_THROWS_AS(BoardState::from_fen("8/8/8/8/8/8/8/8 w - - 0 1 x"),
+                    invalid_argument);
+}
+
+TEST_CASE("epd", "[BoardState][smoke_test]") {
+  string_view operations;
+  auto b = BoardState::from_epd(
+      "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 bm e5; id "
+      "\"open\";\n",
+      &operations);
+  REQUIRE(b.to_fen() ==
+          "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+  REQUIRE(operations == "bm e5; id \"open\";");
+
+  BoardState::from_epd("8/8/8/8/8/8/8/8 w - -", &operations);
+  REQUIRE(operations.empty());
+  REQUIRE_THROWS_AS(BoardState::from_epd("8/8/8/8/8/8/8/8 w - -bm e5;"),
+                    FenError);
+}
+
+TEST_CASE("fen parsing speed", "[BoardState]") {
+  ifstream f = get_file("Carlsen.pgn");
+  auto games = Pgn::read(f, "Carlsen.pgn");
+  vector<string> fens;
+  for (auto &game : games) {
+    auto b = BoardState::initial();
+    for (auto &m : game.moves) {
+      b.make_move(b.get_move(m));
+      fens.push_back(b.to_fen());
+    }
+  }
+
+  auto start = chrono::steady_clock::now();
+  uint64_t check = 0;
+  for (auto &fen : fens) {
+    check ^= BoardState::from_fen(fen).get_zobrist_hash();
+  }
+  auto end = chrono::steady_clock::now();
+  auto us = chrono::duration_cast<chrono::microseconds>(end - start).count();
+  LOG_INFO("from_fen (Carlsen.pgn) :", fens.size(), "positions,",
+           fens.size() * 1e6 / max<int64_t>(us, 1), "positions per sec");
+
+  char buffer[BoardState::MAX_FEN_LENGTH];
+  size_t length = 0;
+  start = chrono::steady_clock::now();
+  for (auto &fen : fens) {
+    length += BoardState::from_fen(fen).write_fen(buffer);
+  }
+  end = chrono::steady_clock::now();
+  us = chrono::duration_cast<chrono::microseconds>(end - start).count();
+  LOG_INFO("from_fen + write_fen (Carlsen.pgn) :", fens.size(), "positions,",
+           fens.size() * 1e6 / max<int64_t>(us, 1), "positions per sec");
+  REQUIRE(check != 0);
+  REQUIRE(length > 0);
+}
@@ -10,4 +10,20 @@ TEST_CASE("basic eval", "[Evaluator]") {
   auto b = BoardState::initial();
   Evaluator evaluator;
   auto m = evaluator.eval(b, 3);
-}
\ No newline at end of file
+}
+TEST_CASE("lazy smp", "[Evaluator]") {
+  auto b = BoardState::from_fen("6k1/5ppp/8/8/8/8/8/R5K1 w - - 0 1");
+  Evaluator evaluator(4);
+  REQUIRE(evaluator.get_threads() == 4);
+  SearchResult result = evaluator.search(b, 4);
+  REQUIRE(result.best_move.to_str() == "a1a8");
+  REQUIRE(result.score == Negamax::MATE_SCORE - 1);
+
+  b = BoardState::from_fen(
+      "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3");
+  result = evaluator.search(b, Negamax::MAX_PLY - 1, 300);
+  REQUIRE(result.depth >= 1);
+  for (auto &move : result.pv) {
+    REQUIRE(b.make_move(move));
+  }
+}
@@ -0,0 +1,115 @@
+#include <catch.hpp>
+
+#include "evaluator/MovePicker.hpp"
+
+#include <algorithm>
+#include <set>
+
+using namespace std;
+using namespace siegbert;
+
+static const vector<string> fens = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+    // in check
+    "4k3/4b3/3N4/8/8/8/8/4Q1K1 b - - 0 1"};
+
+static vector<uint16_t> picked(MovePicker &picker) {
+  vector<uint16_t> codes;
+  Move move;
+  while (picker.next(move)) {
+    codes.push_back(move.to_short());
+  }
+  return codes;
+}
+
+static vector<uint16_t> codes_of(const vector<Move> &moves) {
+  vector<uint16_t> codes;
+  for (auto &move : moves) {
+    codes.push_back(move.to_short());
+  }
+  return codes;
+}
+
+TEST_CASE("all legal moves, once", "[MovePicker]") {
+  for (auto &fen : fens) {
+    auto b = BoardState::from_fen(fen);
+    auto expected = codes_of(b.generate_legal_moves());
+    sort(expected.begin(), expected.end());
+
+    // no hints, then the hints taken among the legal moves
+    for (size_t i = 0; i <= expected.size(); i += 1) {
+      const uint16_t hash_move = i ? expected[i - 1] : 0;
+      const uint16_t killers[MovePicker::MAX_KILLERS] = {
+          expected[(i + 1) % expected.size()],
+          expected[(i + 2) % expected.size()]};
+      MovePicker picker(b, b.is_check(), hash_move, killers);
+      auto codes = picked(picker);
+      if (hash_move) {
+        REQUIRE(codes.front() == hash_move);
+      }
+      sort(codes.begin(), codes.end());
+      REQUIRE(codes == expected);
+    }
+  }
+}
+
+TEST_CASE("hints not playable in the position", "[MovePicker]") {
+  auto b = BoardState::initial();
+  // e7e5 and a1a8 are not legal here
+  const uint16_t e7e5 = 52 | (36 << 6);
+  const uint16_t a1a8 = 0 | (56 << 6);
+  const uint16_t killers[MovePicker::MAX_KILLERS] = {a1a8, e7e5};
+  MovePicker picker(b, b.is_check(), e7e5, killers);
+  REQUIRE(picked(picker).size() == 20);
+}
+
+TEST_CASE("captures first, killers before quiets", "[MovePicker]") {
+  // the pawn on d5 can take the knight on e6 or the pawn on c6
+  auto b = BoardState::from_fen(
+      "r1bqkb1r/pp1p1ppp/2p1n3/3P4/8/2N5/PPP2PPP/R1BQKBNR w KQkq - 0 1");
+  const uint16_t killer = b.get_move("g1f3").to_short();
+  const uint16_t killers[MovePicker::MAX_KILLERS] = {killer, 0};
+  MovePicker picker(b, b.is_check(), 0, killers);
+  Move move;
+  REQUIRE(picker.next(move));
+  REQUIRE(move.to_str() == "d5e6");
+  REQUIRE(picker.next(move));
+  REQUIRE(move.to_str() == "d5c6");
+  REQUIRE(picker.next(move));
+  REQUIRE(move.to_short() == killer);
+  while (picker.next(move)) {
+    REQUIRE(move.to_short() != killer);
+  }
+}
+
+TEST_CASE("quiescence picker", "[MovePicker]") {
+  auto b = BoardState::from_fen(fens[1]);
+  MovePicker picker(b, b.is_check());
+  Move move;
+  int count = 0;
+  while (picker.next(move)) {
+    REQUIRE((move.captured || move.promotion));
+    count += 1;
+  }
+  // the losing trades and the underpromotions are left out
+  MoveList captures;
+  b.generate_captures(captures);
+  int good = 0;
+  for (const Move &capture : captures) {
+    if (capture.promotion == 'q' ||
+        (!capture.promotion && b.see_ge(capture))) {
+      good += 1;
+    }
+  }
+  REQUIRE(good < captures.size());
+  REQUIRE(count == good);
+
+  // when in check, all the evasions are returned
+  auto in_check = BoardState::from_fen(fens.back());
+  MovePicker evasions(in_check, in_check.is_check());
+  REQUIRE(picked(evasions).size() == 3);
+}
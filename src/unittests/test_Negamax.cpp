@@ -0,0 +1,43 @@
+#include "evaluator/Negamax.hpp"
+#include <catch.hpp>
+
+using namespace siegbert;
+
+TEST_CASE("mate in one", "[Negamax]") {
+  Negamax negamax;
+  negamax.set_boardState(
+      BoardState::from_fen("6k1/5ppp/8/8/8/8/8/R5K1 w - - 0 1"));
+  SearchResult result = negamax.search(4);
+  REQUIRE(result.best_move.to_str() == "a1a8");
+  REQUIRE(result.score == Negamax::MATE_SCORE - 1);
+}
+
+TEST_CASE("principal variation is playable", "[Negamax]") {
+  auto b = BoardState::from_fen(
+      "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3");
+  Negamax negamax;
+  negamax.set_boardState(b);
+  SearchResult result = negamax.search(4);
+  REQUIRE(result.depth == 4);
+  REQUIRE(!result.pv.empty());
+  for (auto &move : result.pv) {
+    REQUIRE(b.make_move(move));
+  }
+}
+
+TEST_CASE("no legal moves", "[Negamax]") {
+  Negamax negamax;
+  // stalemate
+  negamax.set_boardState(BoardState::from_fen("7k/5Q2/6K1/8/8/8/8/8 b - - 0 1"));
+  SearchResult result = negamax.search(3);
+  REQUIRE(result.pv.empty());
+  REQUIRE(result.score == 0);
+}
+
+TEST_CASE("time budget", "[Negamax]") {
+  Negamax negamax;
+  negamax.set_boardState(BoardState::initial());
+  SearchResult result = negamax.search(Negamax::MAX_PLY - 1, 200);
+  REQUIRE(result.depth >= 1);
+  REQUIRE(!result.pv.empty());
+}
@@ -1,15 +1,89 @@
 #include "evaluator/TranspositionTable.hpp"
 #include <catch.hpp>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace siegbert;
 
 TEST_CASE("smoke test", "[transposition table]") {
   TranspositionTable t;
 
-  t.put(0x463b96181691fc9c, {.depth = 21, .flag = EXACT, .value = -4});
+  t.put(0x463b96181691fc9c,
+        {.depth = 21, .flag = EXACT, .value = -4, .move = 0});
 
   TTableEntry entry;
   REQUIRE(t.find(0x463b96181691fc9c, entry) == true);
   REQUIRE(entry.depth == 21);
   REQUIRE(entry.value == -4);
-}
\ No newline at end of file
+  REQUIRE(entry.move == 0);
+
+  t.put(0x463b96181691fc9c,
+        {.depth = 22, .flag = LOWERBOUND, .value = 1, .move = 0x7fff});
+  REQUIRE(t.find(0x463b96181691fc9c, entry) == true);
+  REQUIRE(entry.move == 0x7fff);
+
+  // the best move is kept when the new entry does not provide one
+  t.put(0x463b96181691fc9c,
+        {.depth = 23, .flag = EXACT, .value = 2, .move = 0});
+  REQUIRE(t.find(0x463b96181691fc9c, entry) == true);
+  REQUIRE(entry.depth == 23);
+  REQUIRE(entry.move == 0x7fff);
+}
+
+TEST_CASE("replacement", "[transposition table]") {
+  TranspositionTable t(1);
+  TTableEntry entry;
+
+  // keys sharing the same bucket
+  const uint64_t stride = t.capacity() / 4;
+  for (uint64_t i = 0; i < 4; i++) {
+    t.put(1 + i * stride, {.depth = (int)(10 + i), .flag = LOWERBOUND,
+                           .value = (int)i, .move = 0});
+  }
+  for (uint64_t i = 0; i < 4; i++) {
+    REQUIRE(t.find(1 + i * stride, entry));
+    REQUIRE(entry.flag == LOWERBOUND);
+  }
+
+  // the bucket is full, the shallowest entry is evicted
+  t.put(1 + 4 * stride,
+        {.depth = 1, .flag = UPPERBOUND, .value = 7, .move = 0});
+  REQUIRE_FALSE(t.find(1, entry));
+  REQUIRE(t.find(1 + 4 * stride, entry));
+  REQUIRE(entry.flag == UPPERBOUND);
+  REQUIRE(entry.value == 7);
+
+  // entries from previous searches are replaced first
+  t.new_search();
+  t.put(1 + 5 * stride, {.depth = 0, .flag = EXACT, .value = 0, .move = 0});
+  REQUIRE(t.find(1 + 5 * stride, entry));
+  REQUIRE_FALSE(t.find(1 + 4 * stride, entry));
+
+  t.clear();
+  REQUIRE_FALSE(t.find(1 + 5 * stride, entry));
+}
+
+TEST_CASE("concurrent access", "[transposition table]") {
+  TranspositionTable t(1);
+  std::atomic<int> mismatches(0);
+  std::vector<std::thread> threads;
+  for (int n = 0; n < 4; n++) {
+    threads.push_back(std::thread([&t, &mismatches, n] {
+      TTableEntry entry;
+      for (uint64_t z = 1; z < 100000; z++) {
+        t.put(z * 0x9E3779B97F4A7C15, {.depth = n, .flag = EXACT,
+                                       .value = (int)(z & 0xffff), .move = 0});
+        if (t.find(z * 0x9E3779B97F4A7C15, entry) &&
+            entry.value != (int)(z & 0xffff)) {
+          mismatches++;
+        }
+      }
+    }));
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  REQUIRE(mismatches == 0);
+}
@@ -0,0 +1,52 @@
+#include "interface/EngineIO.hpp"
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+using namespace std;
+
+using namespace siegbert;
+
+static int count_lines(const string &output, const string &prefix) {
+  istringstream lines(output);
+  int count = 0;
+  for (string line; getline(lines, line);) {
+    if (line.rfind(prefix, 0) == 0) {
+      count += 1;
+    }
+  }
+  return count;
+}
+
+TEST_CASE("go and stop", "[UciInterface]") {
+  // the searches have no limit : only stop ends them
+  istringstream in("uci\n"
+                   "position startpos moves e2e4\n"
+                   "go infinite\n"
+                   "isready\n"
+                   "stop\n"
+                   "go\n"
+                   "stop\n"
+                   "quit\n");
+  ostringstream out;
+  EngineIO io;
+  io.run(in, out);
+  REQUIRE(count_lines(out.str(), "bestmove ") == 2);
+  REQUIRE(count_lines(out.str(), "readyok") == 1);
+  REQUIRE(count_lines(out.str(), "info unrecognized command") == 0);
+}
+
+TEST_CASE("go depth", "[UciInterface]") {
+  // the next command waits for the search to be over
+  istringstream in("uci\n"
+                   "position startpos\n"
+                   "go depth 3\n"
+                   "position startpos moves e2e4\n"
+                   "go depth 2\n"
+                   "quit\n");
+  ostringstream out;
+  EngineIO io;
+  io.run(in, out);
+  REQUIRE(count_lines(out.str(), "bestmove ") == 2);
+  REQUIRE(count_lines(out.str(), "info depth 3") == 1);
+}